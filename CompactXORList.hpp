@@ -0,0 +1,399 @@
+#ifndef _SCC_COMPACT_XORLIST_HPP_
+#define _SCC_COMPACT_XORLIST_HPP_
+#pragma once
+
+#include <XORListForest.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace scc
+{
+    // XOR-linked list whose nodes link through 32-bit slot indices instead of pointers.
+    //
+    // Nodes live in a growable slot array (detail::SlotArena) owned by the list, so a CompactXORList<int> spends
+    // 8 bytes per element where XORList<int> spends 16 plus malloc overhead. Chunks double from 16 slots up to
+    // 4096, so unused capacity stays below the element count plus one chunk. Iteration, insert and erase behave as in XORList; references stay valid until
+    // their element is erased. The list holds fewer than 2^32 elements.
+    template <typename T, CanThrow canThrow = CanThrow::NoThrow, typename Allocator = std::allocator<T>>
+    class CompactXORList
+    {
+    private:
+        using Arena = detail::SlotArena<T, Allocator>;
+        using Chain = typename Arena::Chain;
+        using index_type = typename Arena::index_type;
+
+        Arena m_arena_;
+        Chain m_chain_;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = detail::SlotArenaIterator<T, Allocator, false>;
+        using const_iterator = detail::SlotArenaIterator<T, Allocator, true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        // Bytes one element occupies in the slot array.
+        static constexpr size_t node_size = Arena::slot_size;
+
+        explicit CompactXORList(const Allocator &allocator = Allocator()) noexcept
+            : m_arena_(allocator), m_chain_{0, 0, 0} {}
+
+        CompactXORList(size_t count, const T &value, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : CompactXORList(allocator)
+        {
+            m_arena_.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                emplace_back(value);
+            }
+        }
+
+        template <class InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+        CompactXORList(InputIt first, InputIt last, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : CompactXORList(allocator)
+        {
+            append(first, last);
+        }
+
+        CompactXORList(std::initializer_list<T> init, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : CompactXORList(init.begin(), init.end(), allocator) {}
+
+        CompactXORList(const CompactXORList &other) noexcept(canThrow == CanThrow::NoThrow)
+            : CompactXORList(other.cbegin(), other.cend(),
+                             std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_arena_.get_allocator())) {}
+
+        CompactXORList(CompactXORList &&other) noexcept
+            : m_arena_(std::move(other.m_arena_)), m_chain_(other.m_chain_)
+        {
+            other.m_chain_ = Chain{0, 0, 0};
+        }
+
+        ~CompactXORList()
+        {
+            m_arena_.clear(m_chain_);
+        }
+
+        CompactXORList &operator=(const CompactXORList &other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (this != &other)
+            {
+                CompactXORList copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        CompactXORList &operator=(CompactXORList &&other) noexcept
+        {
+            if (this != &other)
+            {
+                CompactXORList moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        CompactXORList &operator=(std::initializer_list<T> init) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            CompactXORList copy(init, m_arena_.get_allocator());
+            swap(copy);
+            return *this;
+        }
+
+        void swap(CompactXORList &other) noexcept
+        {
+            m_arena_.swap(other.m_arena_);
+            std::swap(m_chain_, other.m_chain_);
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return m_arena_.get_allocator();
+        }
+
+        size_t size() const noexcept
+        {
+            return m_chain_.size;
+        }
+
+        bool empty() const noexcept
+        {
+            return m_chain_.size == 0;
+        }
+
+        // Slots the list can hold before it allocates another chunk.
+        size_t capacity() const noexcept
+        {
+            return m_arena_.capacity();
+        }
+
+        void reserve(size_t count) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (count > size())
+            {
+                m_arena_.reserve(count - size());
+            }
+        }
+
+        T &front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_chain_.head);
+        }
+
+        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_chain_.head);
+        }
+
+        T &back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_chain_.tail);
+        }
+
+        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_chain_.tail);
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(&m_arena_, 0, m_chain_.head);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(&m_arena_, m_chain_.tail, 0);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return cbegin();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return cend();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(&m_arena_, 0, m_chain_.head);
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(&m_arena_, m_chain_.tail, 0);
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return const_reverse_iterator(cend());
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return const_reverse_iterator(cbegin());
+        }
+
+        template <class... Args>
+        T &emplace_back(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            index_type index = m_arena_.make(std::forward<Args>(args)...);
+            m_arena_.link(m_chain_, m_chain_.tail, 0, index);
+            return m_arena_.value(index);
+        }
+
+        template <class... Args>
+        T &emplace_front(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            index_type index = m_arena_.make(std::forward<Args>(args)...);
+            m_arena_.link(m_chain_, 0, m_chain_.head, index);
+            return m_arena_.value(index);
+        }
+
+        void push_back(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(std::move(value));
+        }
+
+        void push_front(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(value);
+        }
+
+        void push_front(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(std::move(value));
+        }
+
+        void pop_back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            index_type index = m_chain_.tail;
+            m_arena_.unlink(m_chain_, m_arena_.npx(index), index);
+            m_arena_.destroy(index);
+        }
+
+        void pop_front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            index_type index = m_chain_.head;
+            m_arena_.unlink(m_chain_, 0, index);
+            m_arena_.destroy(index);
+        }
+
+        // Constructs an element in front of `pos` and returns an iterator to it. Like XORList, iterators to the
+        // element after the new one go stale because their predecessor changes.
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            index_type index = m_arena_.make(std::forward<Args>(args)...);
+            m_arena_.link(m_chain_, pos.prev_, pos.current_, index);
+            return iterator(&m_arena_, pos.prev_, index);
+        }
+
+        iterator insert(const_iterator pos, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        // Erases the element at `pos` and returns the iterator following it.
+        iterator erase(const_iterator pos) noexcept
+        {
+            if (pos.current_ == 0)
+            {
+                return iterator(&m_arena_, pos.prev_, 0);
+            }
+
+            index_type next = m_arena_.unlink(m_chain_, pos.prev_, pos.current_);
+            m_arena_.destroy(pos.current_);
+            return iterator(&m_arena_, pos.prev_, next);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            iterator it(&m_arena_, first.prev_, first.current_);
+            while (it.current_ != last.current_)
+            {
+                it = erase(it);
+            }
+            return it;
+        }
+
+        // Appends [first, last) at the back.
+        template <class InputIt>
+        void append(InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            using Category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+            {
+                m_arena_.reserve(static_cast<size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        void clear() noexcept
+        {
+            m_arena_.clear(m_chain_);
+        }
+
+        // Reverses the list in O(1): an XOR-linked chain reads the same in both directions.
+        void reverse() noexcept
+        {
+            std::swap(m_chain_.head, m_chain_.tail);
+        }
+
+        bool operator==(const CompactXORList &other) const
+        {
+            return size() == other.size() && std::equal(cbegin(), cend(), other.cbegin());
+        }
+
+        bool operator!=(const CompactXORList &other) const
+        {
+            return !(*this == other);
+        }
+    };
+}
+
+#endif // _SCC_COMPACT_XORLIST_HPP_
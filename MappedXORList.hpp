@@ -0,0 +1,567 @@
+#ifndef _SCC_MAPPED_XORLIST_HPP_
+#define _SCC_MAPPED_XORLIST_HPP_
+#pragma once
+
+#include <XORList.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace scc
+{
+    namespace detail
+    {
+        // Fixed header at offset 0 of a MappedXORList file. Every link in the file is a byte offset from the start
+        // of the mapping, so the file stays valid wherever it is mapped.
+        struct MappedFileHeader
+        {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t node_size;
+            std::uint64_t head;
+            std::uint64_t tail;
+            std::uint64_t size;
+            std::uint64_t free;     // first node on the free list, linked through npx
+            std::uint64_t used;     // end of the nodes ever handed out
+            std::uint64_t capacity; // file size
+        };
+
+        inline constexpr std::uint64_t kMappedMagic = 0x5453494c524f5853ULL; // "SXORLIST"
+        inline constexpr std::uint32_t kMappedVersion = 1;
+    }
+
+    // XOR-linked list of trivially copyable T stored in a memory-mapped file.
+    //
+    // Nodes store the XOR of their neighbours' file offsets instead of pointers, so reopening the file maps the
+    // list back in without reading or rebuilding anything, at whatever address the mapping lands. The file grows
+    // in chunks (doubling, starting at 64 KiB) and erased nodes are recycled through a free list kept in the file.
+    // Iterators hold offsets and survive growth; references into the list do not.
+    //
+    // Opening, growing or mapping the file reports failure with std::system_error in both CanThrow modes; a
+    // file written for a different T is rejected with std::runtime_error. Changes reach the file when the kernel
+    // writes back the mapping, or at flush(). There is no crash consistency beyond that.
+    template <typename T, CanThrow canThrow = CanThrow::NoThrow>
+    class MappedXORList
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "MappedXORList stores T as raw bytes in the file");
+
+    private:
+        struct Node
+        {
+            T value;
+            std::uint64_t npx; // XOR of next and previous file offsets; the next free node while unused
+        };
+
+        using Header = detail::MappedFileHeader;
+
+        static constexpr std::uint64_t kDataStart = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+        static constexpr std::uint64_t kInitialCapacity = 64 * 1024;
+
+        int m_fd_;
+        unsigned char *m_base_;
+
+        Header *header() const noexcept
+        {
+            return reinterpret_cast<Header *>(m_base_);
+        }
+
+        Node *node(std::uint64_t offset) const noexcept
+        {
+            return reinterpret_cast<Node *>(m_base_ + offset);
+        }
+
+        [[noreturn]] static void fail(const char *what)
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        // Maps the first `length` bytes of the file, replacing the current mapping only once the new one exists.
+        void map(std::uint64_t length)
+        {
+            void *mapping = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd_, 0);
+            if (mapping == MAP_FAILED)
+            {
+                fail("MappedXORList: mmap failed");
+            }
+            if (m_base_ != nullptr)
+            {
+                ::munmap(m_base_, header()->capacity);
+            }
+            m_base_ = static_cast<unsigned char *>(mapping);
+        }
+
+        void grow(std::uint64_t minimum)
+        {
+            std::uint64_t capacity = header()->capacity;
+            while (capacity < minimum)
+            {
+                capacity *= 2;
+            }
+            if (::ftruncate(m_fd_, static_cast<off_t>(capacity)) != 0)
+            {
+                fail("MappedXORList: growing the file failed");
+            }
+            map(capacity);
+            header()->capacity = capacity;
+        }
+
+        std::uint64_t acquire()
+        {
+            Header *h = header();
+            if (h->free != 0)
+            {
+                std::uint64_t offset = h->free;
+                h->free = node(offset)->npx;
+                return offset;
+            }
+            if (h->used + sizeof(Node) > h->capacity)
+            {
+                grow(h->used + sizeof(Node));
+                h = header();
+            }
+            std::uint64_t offset = h->used;
+            h->used += sizeof(Node);
+            return offset;
+        }
+
+        void release(std::uint64_t offset) noexcept
+        {
+            node(offset)->npx = header()->free;
+            header()->free = offset;
+        }
+
+        // Links `offset` between the adjacent nodes `prev` and `next` (either may be 0 at the ends).
+        void link(std::uint64_t prev, std::uint64_t next, std::uint64_t offset) noexcept
+        {
+            Header *h = header();
+            node(offset)->npx = prev ^ next;
+            if (prev != 0)
+            {
+                node(prev)->npx ^= next ^ offset;
+            }
+            else
+            {
+                h->head = offset;
+            }
+            if (next != 0)
+            {
+                node(next)->npx ^= prev ^ offset;
+            }
+            else
+            {
+                h->tail = offset;
+            }
+            ++h->size;
+        }
+
+        // Unlinks `offset`, whose predecessor is `prev`, and returns its successor.
+        std::uint64_t unlink(std::uint64_t prev, std::uint64_t offset) noexcept
+        {
+            Header *h = header();
+            std::uint64_t next = prev ^ node(offset)->npx;
+            if (prev != 0)
+            {
+                node(prev)->npx ^= offset ^ next;
+            }
+            else
+            {
+                h->head = next;
+            }
+            if (next != 0)
+            {
+                node(next)->npx ^= offset ^ prev;
+            }
+            else
+            {
+                h->tail = prev;
+            }
+            --h->size;
+            return next;
+        }
+
+        void close() noexcept
+        {
+            if (m_base_ != nullptr)
+            {
+                ::munmap(m_base_, header()->capacity);
+                m_base_ = nullptr;
+            }
+            if (m_fd_ >= 0)
+            {
+                ::close(m_fd_);
+                m_fd_ = -1;
+            }
+        }
+
+    public:
+        template <bool IsConst>
+        class MappedXORListIterator
+        {
+        private:
+            using ListType = std::conditional_t<IsConst, const MappedXORList, MappedXORList>;
+
+            ListType *list_;
+            std::uint64_t prev_;
+            std::uint64_t current_;
+
+            friend class MappedXORList<T, canThrow>;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T *, T *>;
+            using reference = std::conditional_t<IsConst, const T &, T &>;
+
+            MappedXORListIterator(ListType *list, std::uint64_t prev, std::uint64_t current)
+                : list_(list), prev_(prev), current_(current) {}
+
+            template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+            MappedXORListIterator(const MappedXORListIterator<WasConst> &other)
+                : list_(other.list_), prev_(other.prev_), current_(other.current_) {}
+
+            reference operator*() const { return list_->node(current_)->value; }
+            pointer operator->() const { return &list_->node(current_)->value; }
+
+            MappedXORListIterator &operator++()
+            {
+                if (current_ == 0)
+                {
+                    return *this; // Already at end, do nothing
+                }
+
+                std::uint64_t next = prev_ ^ list_->node(current_)->npx;
+                prev_ = current_;
+                current_ = next;
+                return *this;
+            }
+
+            MappedXORListIterator operator++(int)
+            {
+                MappedXORListIterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            MappedXORListIterator &operator--()
+            {
+                if (prev_ == 0)
+                {
+                    return *this; // Already at begin, do nothing
+                }
+
+                std::uint64_t before = list_->node(prev_)->npx ^ current_;
+                current_ = prev_;
+                prev_ = before;
+                return *this;
+            }
+
+            MappedXORListIterator operator--(int)
+            {
+                MappedXORListIterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            bool operator==(const MappedXORListIterator &other) const { return current_ == other.current_; }
+            bool operator!=(const MappedXORListIterator &other) const { return current_ != other.current_; }
+
+            template <bool>
+            friend class MappedXORListIterator;
+        };
+
+        using value_type = T;
+        using iterator = MappedXORListIterator<false>;
+        using const_iterator = MappedXORListIterator<true>;
+
+        // Opens the list stored at `path`, creating an empty one if the file does not exist or is empty.
+        explicit MappedXORList(const std::string &path) : m_fd_(-1), m_base_(nullptr)
+        {
+            m_fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (m_fd_ < 0)
+            {
+                fail("MappedXORList: cannot open file");
+            }
+
+            try
+            {
+                struct stat st;
+                if (::fstat(m_fd_, &st) != 0)
+                {
+                    fail("MappedXORList: cannot stat file");
+                }
+
+                if (st.st_size == 0)
+                {
+                    if (::ftruncate(m_fd_, static_cast<off_t>(kInitialCapacity)) != 0)
+                    {
+                        fail("MappedXORList: cannot size file");
+                    }
+                    map(kInitialCapacity);
+                    *header() = Header{detail::kMappedMagic, detail::kMappedVersion, sizeof(Node), 0, 0, 0, 0, kDataStart, kInitialCapacity};
+                }
+                else
+                {
+                    if (static_cast<std::uint64_t>(st.st_size) < sizeof(Header))
+                    {
+                        throw std::runtime_error("MappedXORList: file is not a MappedXORList");
+                    }
+                    std::uint64_t length = static_cast<std::uint64_t>(st.st_size);
+                    map(length);
+                    Header *h = header();
+                    if (h->magic != detail::kMappedMagic || h->version != detail::kMappedVersion ||
+                        h->node_size != sizeof(Node) || h->capacity > length || h->used > length)
+                    {
+                        ::munmap(m_base_, static_cast<size_t>(length));
+                        m_base_ = nullptr;
+                        throw std::runtime_error("MappedXORList: file was written for another element type or is damaged");
+                    }
+                    h->capacity = length; // the file may have grown without the header catching up
+                }
+            }
+            catch (...)
+            {
+                close();
+                throw;
+            }
+        }
+
+        MappedXORList(const MappedXORList &) = delete;
+        MappedXORList &operator=(const MappedXORList &) = delete;
+
+        MappedXORList(MappedXORList &&other) noexcept : m_fd_(other.m_fd_), m_base_(other.m_base_)
+        {
+            other.m_fd_ = -1;
+            other.m_base_ = nullptr;
+        }
+
+        MappedXORList &operator=(MappedXORList &&other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                m_fd_ = std::exchange(other.m_fd_, -1);
+                m_base_ = std::exchange(other.m_base_, nullptr);
+            }
+            return *this;
+        }
+
+        ~MappedXORList()
+        {
+            close();
+        }
+
+        // Writes dirty pages back to the file and waits for the write to finish.
+        void flush()
+        {
+            if (::msync(m_base_, header()->capacity, MS_SYNC) != 0)
+            {
+                fail("MappedXORList: msync failed");
+            }
+        }
+
+        size_t size() const noexcept
+        {
+            return static_cast<size_t>(header()->size);
+        }
+
+        bool empty() const noexcept
+        {
+            return header()->size == 0;
+        }
+
+        // Bytes the file currently occupies.
+        size_t file_size() const noexcept
+        {
+            return static_cast<size_t>(header()->capacity);
+        }
+
+        // Grows the file so that `count` more elements fit without remapping.
+        void reserve(size_t count)
+        {
+            std::uint64_t needed = header()->used + static_cast<std::uint64_t>(count) * sizeof(Node);
+            if (needed > header()->capacity)
+            {
+                grow(needed);
+            }
+        }
+
+        T &front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return node(header()->head)->value;
+        }
+
+        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return node(header()->head)->value;
+        }
+
+        T &back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return node(header()->tail)->value;
+        }
+
+        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return node(header()->tail)->value;
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(this, 0, header()->head);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, header()->tail, 0);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return cbegin();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return cend();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(this, 0, header()->head);
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(this, header()->tail, 0);
+        }
+
+        void push_back(const T &value)
+        {
+            T copy = value; // `value` may live in the mapping, which acquire() can move
+            std::uint64_t offset = acquire();
+            node(offset)->value = copy;
+            link(header()->tail, 0, offset);
+        }
+
+        void push_front(const T &value)
+        {
+            T copy = value;
+            std::uint64_t offset = acquire();
+            node(offset)->value = copy;
+            link(0, header()->head, offset);
+        }
+
+        void pop_back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            std::uint64_t offset = header()->tail;
+            unlink(node(offset)->npx, offset);
+            release(offset);
+        }
+
+        void pop_front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            std::uint64_t offset = header()->head;
+            unlink(0, offset);
+            release(offset);
+        }
+
+        // Inserts `value` in front of `pos` and returns an iterator to it.
+        iterator insert(const_iterator pos, const T &value)
+        {
+            T copy = value;
+            std::uint64_t offset = acquire();
+            node(offset)->value = copy;
+            link(pos.prev_, pos.current_, offset);
+            return iterator(this, pos.prev_, offset);
+        }
+
+        // Erases the element at `pos` and returns the iterator following it.
+        iterator erase(const_iterator pos) noexcept
+        {
+            if (pos.current_ == 0)
+            {
+                return iterator(this, pos.prev_, 0);
+            }
+
+            std::uint64_t next = unlink(pos.prev_, pos.current_);
+            release(pos.current_);
+            return iterator(this, pos.prev_, next);
+        }
+
+        // Empties the list. Node storage is recycled wholesale, without walking the chain.
+        void clear() noexcept
+        {
+            Header *h = header();
+            h->head = h->tail = h->size = h->free = 0;
+            h->used = kDataStart;
+        }
+    };
+}
+
+#endif // _SCC_MAPPED_XORLIST_HPP_
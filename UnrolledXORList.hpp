@@ -0,0 +1,877 @@
+#ifndef _SCC_UNROLLED_XORLIST_HPP_
+#define _SCC_UNROLLED_XORLIST_HPP_
+#pragma once
+
+#include <XORList.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include <limits>
+#include <algorithm>
+#include <initializer_list>
+
+namespace scc
+{
+    namespace detail
+    {
+        // Aim for roughly 256 bytes of payload per node, but never fewer than two slots.
+        template <typename T>
+        constexpr size_t unrolled_capacity()
+        {
+            return sizeof(T) * 2 < 256 ? 256 / sizeof(T) : 2;
+        }
+    } // namespace detail
+
+    // XOR-linked list whose nodes each hold up to N elements.
+    //
+    // Every node keeps its elements in a small ring buffer, so pushes and pops at either end of a node are
+    // O(1) and a middle insert/erase shifts at most N elements. Each node also carries an orientation bit;
+    // XORed with the list-wide orientation it tells in which direction the ring is read, which is what keeps
+    // reverse() O(1) even though the elements inside a node are stored in order.
+    //
+    // Inserting or erasing invalidates iterators into the touched node and its neighbours.
+    template <typename T, size_t N = detail::unrolled_capacity<T>(), CanThrow canThrow = CanThrow::NoThrow, typename Allocator = std::allocator<T>>
+    class UnrolledXORList
+    {
+        static_assert(N >= 2, "UnrolledXORList needs room for at least two elements per node");
+        static_assert(N <= std::numeric_limits<std::uint32_t>::max(), "UnrolledXORList node capacity is too large");
+
+    private:
+        struct Node
+        {
+            Node *npx; // XOR of next and previous node pointers
+            std::uint32_t first;
+            std::uint32_t count;
+            bool flipped;
+            alignas(T) unsigned char storage[sizeof(T) * N];
+
+            Node() : npx(nullptr), first(0), count(0), flipped(false) {}
+
+            T *slot(size_t physical)
+            {
+                return std::launder(reinterpret_cast<T *>(storage)) + (first + physical) % N;
+            }
+
+            const T *slot(size_t physical) const
+            {
+                return std::launder(reinterpret_cast<const T *>(storage)) + (first + physical) % N;
+            }
+
+            template <class... Args>
+            void construct_back(Args &&...args)
+            {
+                ::new (static_cast<void *>(slot(count))) T(std::forward<Args>(args)...);
+                ++count;
+            }
+
+            template <class... Args>
+            void construct_front(Args &&...args)
+            {
+                std::uint32_t before = static_cast<std::uint32_t>((first + N - 1) % N);
+                ::new (static_cast<void *>(std::launder(reinterpret_cast<T *>(storage)) + before)) T(std::forward<Args>(args)...);
+                first = before;
+                ++count;
+            }
+
+            void destroy_back() noexcept
+            {
+                slot(count - 1)->~T();
+                --count;
+            }
+
+            void destroy_front() noexcept
+            {
+                slot(0)->~T();
+                first = static_cast<std::uint32_t>((first + 1) % N);
+                --count;
+            }
+
+            // Inserts at a physical position, shifting the tail of the ring up by one.
+            template <class... Args>
+            void insert_at(size_t physical, Args &&...args)
+            {
+                if (physical == count)
+                {
+                    construct_back(std::forward<Args>(args)...);
+                    return;
+                }
+                if (physical == 0)
+                {
+                    construct_front(std::forward<Args>(args)...);
+                    return;
+                }
+
+                T value(std::forward<Args>(args)...);
+                construct_back(std::move(*slot(count - 1)));
+                for (size_t i = count - 2; i > physical; --i)
+                {
+                    *slot(i) = std::move(*slot(i - 1));
+                }
+                *slot(physical) = std::move(value);
+            }
+
+            // Erases at a physical position, shifting the tail of the ring down by one.
+            void erase_at(size_t physical) noexcept
+            {
+                if (physical == 0)
+                {
+                    destroy_front();
+                    return;
+                }
+                for (size_t i = physical; i + 1 < count; ++i)
+                {
+                    *slot(i) = std::move(*slot(i + 1));
+                }
+                destroy_back();
+            }
+        };
+
+        Node *m_head_;
+        Node *m_tail_;
+        size_t m_size_;
+        bool m_reversed_;
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        NodeAllocator alloc_;
+
+        Node *XOR(Node *a, Node *b) const
+        {
+            return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b));
+        }
+
+        const Node *XOR(const Node *a, const Node *b) const
+        {
+            return reinterpret_cast<const Node *>(reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b));
+        }
+
+        // True when the logical order of a node runs backwards through its ring.
+        bool backwards(const Node *node) const noexcept
+        {
+            return node->flipped != m_reversed_;
+        }
+
+        size_t physical(const Node *node, size_t logical) const noexcept
+        {
+            return backwards(node) ? node->count - 1 - logical : logical;
+        }
+
+        T &element(Node *node, size_t logical) const noexcept
+        {
+            return *node->slot(physical(node, logical));
+        }
+
+        const T &element(const Node *node, size_t logical) const noexcept
+        {
+            return *node->slot(physical(node, logical));
+        }
+
+        template <class... Args>
+        void node_insert(Node *node, size_t logical, Args &&...args)
+        {
+            node->insert_at(backwards(node) ? node->count - logical : logical, std::forward<Args>(args)...);
+        }
+
+        void node_erase(Node *node, size_t logical) noexcept
+        {
+            node->erase_at(physical(node, logical));
+        }
+
+        // A node whose ring is read forwards (or backwards) under the current list orientation.
+        Node *allocate_node(bool readBackwards)
+        {
+            Node *newNode = std::allocator_traits<NodeAllocator>::allocate(alloc_, 1);
+            std::allocator_traits<NodeAllocator>::construct(alloc_, newNode);
+            newNode->flipped = readBackwards != m_reversed_;
+            return newNode;
+        }
+
+        // Allocates a node holding a single element, so a throwing constructor never leaves an empty node linked.
+        template <class... Args>
+        Node *make_node(bool readBackwards, Args &&...args)
+        {
+            Node *newNode = allocate_node(readBackwards);
+            try
+            {
+                newNode->construct_back(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate_node(newNode);
+                throw;
+            }
+            return newNode;
+        }
+
+        void deallocate_node(Node *node)
+        {
+            while (node->count != 0)
+            {
+                node->destroy_back();
+            }
+            std::allocator_traits<NodeAllocator>::destroy(alloc_, node);
+            std::allocator_traits<NodeAllocator>::deallocate(alloc_, node, 1);
+        }
+
+        // Links `node` between the adjacent nodes `prev` and `next` (either may be null at the ends).
+        void link_between(Node *prev, Node *next, Node *node) noexcept
+        {
+            node->npx = XOR(prev, next);
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(XOR(prev->npx, next), node);
+            }
+            else
+            {
+                m_head_ = node;
+            }
+            if (next != nullptr)
+            {
+                next->npx = XOR(XOR(next->npx, prev), node);
+            }
+            else
+            {
+                m_tail_ = node;
+            }
+        }
+
+        void unlink(Node *prev, Node *node) noexcept
+        {
+            Node *next = XOR(prev, node->npx);
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(XOR(prev->npx, node), next);
+            }
+            else
+            {
+                m_head_ = next;
+            }
+            if (next != nullptr)
+            {
+                next->npx = XOR(XOR(next->npx, node), prev);
+            }
+            else
+            {
+                m_tail_ = prev;
+            }
+        }
+
+        // Moves the logical elements [from, count) of `node` into a fresh node linked right after it. Elements whose
+        // move may throw are copied instead, so if one throws the fresh node is freed and `node` is left as it was.
+        Node *split_node(Node *prev, Node *node, size_t from)
+        {
+            Node *next = XOR(prev, node->npx);
+            Node *newNode = allocate_node(false);
+            try
+            {
+                for (size_t i = from; i < node->count; ++i)
+                {
+                    newNode->construct_back(std::move_if_noexcept(element(node, i)));
+                }
+            }
+            catch (...)
+            {
+                deallocate_node(newNode);
+                throw;
+            }
+            bool readBackwards = backwards(node);
+            while (node->count > from)
+            {
+                if (readBackwards)
+                {
+                    node->destroy_front();
+                }
+                else
+                {
+                    node->destroy_back();
+                }
+            }
+            link_between(node, next, newNode);
+            return newNode;
+        }
+
+        // Folds `next` into `node` once both together fit in half a node, so erase-heavy lists stay dense. The fold
+        // is only an optimisation: if an element's copy throws, the elements already appended to `node` are
+        // destroyed again and both nodes are left as they were.
+        void absorb_next(Node *prev, Node *node) noexcept
+        {
+            Node *next = XOR(prev, node->npx);
+            if (next == nullptr || node->count + next->count > N / 2)
+            {
+                return;
+            }
+            size_t kept = node->count;
+            try
+            {
+                for (size_t i = 0; i < next->count; ++i)
+                {
+                    node_insert(node, node->count, std::move_if_noexcept(element(next, i)));
+                }
+            }
+            catch (...)
+            {
+                bool readBackwards = backwards(node);
+                while (node->count > kept)
+                {
+                    if (readBackwards)
+                    {
+                        node->destroy_front();
+                    }
+                    else
+                    {
+                        node->destroy_back();
+                    }
+                }
+                return;
+            }
+            unlink(node, next);
+            deallocate_node(next);
+        }
+
+    public:
+        template <bool IsConst>
+        class UnrolledXORListIterator
+        {
+        private:
+            using NodeType = std::conditional_t<IsConst, const Node, Node>;
+            using ListType = std::conditional_t<IsConst, const UnrolledXORList, UnrolledXORList>;
+
+            NodeType *prev_;
+            NodeType *current_;
+            size_t index_;
+            ListType *list_;
+
+            friend class UnrolledXORList;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T *, T *>;
+            using reference = std::conditional_t<IsConst, const T &, T &>;
+
+            UnrolledXORListIterator(NodeType *prev, NodeType *current, size_t index, ListType *list)
+                : prev_(prev), current_(current), index_(index), list_(list) {}
+
+            template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+            UnrolledXORListIterator(const UnrolledXORListIterator<WasConst> &other)
+                : prev_(other.prev_), current_(other.current_), index_(other.index_), list_(other.list_) {}
+
+            reference operator*() const { return list_->element(current_, index_); }
+            pointer operator->() const { return &list_->element(current_, index_); }
+
+            UnrolledXORListIterator &operator++()
+            {
+                if (current_ == nullptr)
+                {
+                    return *this; // Already at end, do nothing
+                }
+
+                if (++index_ < current_->count)
+                {
+                    return *this;
+                }
+
+                NodeType *next = list_->XOR(prev_, current_->npx);
+                prev_ = current_;
+                current_ = next;
+                index_ = 0;
+                return *this;
+            }
+
+            UnrolledXORListIterator operator++(int)
+            {
+                UnrolledXORListIterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            UnrolledXORListIterator &operator--()
+            {
+                if (index_ > 0)
+                {
+                    --index_;
+                    return *this;
+                }
+
+                if (prev_ == nullptr)
+                {
+                    return *this; // Already at begin, do nothing
+                }
+
+                NodeType *prev = list_->XOR(prev_->npx, current_);
+                current_ = prev_;
+                prev_ = prev;
+                index_ = current_->count - 1;
+                return *this;
+            }
+
+            UnrolledXORListIterator operator--(int)
+            {
+                UnrolledXORListIterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            bool operator==(const UnrolledXORListIterator &other) const { return current_ == other.current_ && index_ == other.index_; }
+            bool operator!=(const UnrolledXORListIterator &other) const { return !(*this == other); }
+
+            template <bool>
+            friend class UnrolledXORListIterator;
+        };
+
+        using iterator = UnrolledXORListIterator<false>;
+        using const_iterator = UnrolledXORListIterator<true>;
+
+        explicit UnrolledXORList(const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), m_reversed_(false), alloc_(allocator) {}
+
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        UnrolledXORList(InputIt first, InputIt last, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : UnrolledXORList(allocator)
+        {
+            for (InputIt it = first; it != last; ++it)
+            {
+                emplace_back(*it);
+            }
+        }
+
+        UnrolledXORList(std::initializer_list<T> init, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : UnrolledXORList(init.begin(), init.end(), allocator) {}
+
+        UnrolledXORList(const UnrolledXORList &other) noexcept(canThrow == CanThrow::NoThrow)
+            : UnrolledXORList(std::allocator_traits<NodeAllocator>::select_on_container_copy_construction(other.alloc_))
+        {
+            for (const T &value : other)
+            {
+                emplace_back(value);
+            }
+        }
+
+        UnrolledXORList(UnrolledXORList &&other) noexcept
+            : m_head_(other.m_head_), m_tail_(other.m_tail_), m_size_(other.m_size_), m_reversed_(other.m_reversed_), alloc_(std::move(other.alloc_))
+        {
+            other.m_head_ = other.m_tail_ = nullptr;
+            other.m_size_ = 0;
+        }
+
+        ~UnrolledXORList()
+        {
+            clear();
+        }
+
+        UnrolledXORList &operator=(const UnrolledXORList &other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (this != &other)
+            {
+                clear();
+                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_copy_assignment::value)
+                {
+                    alloc_ = other.alloc_;
+                }
+                for (const T &value : other)
+                {
+                    emplace_back(value);
+                }
+            }
+            return *this;
+        }
+
+        UnrolledXORList &operator=(UnrolledXORList &&other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (this != &other)
+            {
+                clear();
+                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_move_assignment::value)
+                {
+                    alloc_ = std::move(other.alloc_);
+                }
+                else if (alloc_ != other.alloc_)
+                {
+                    for (T &value : other)
+                    {
+                        emplace_back(std::move(value));
+                    }
+                    other.clear();
+                    return *this;
+                }
+                m_head_ = other.m_head_;
+                m_tail_ = other.m_tail_;
+                m_size_ = other.m_size_;
+                m_reversed_ = other.m_reversed_;
+
+                other.m_head_ = other.m_tail_ = nullptr;
+                other.m_size_ = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const UnrolledXORList &other) const noexcept
+        {
+            return m_size_ == other.m_size_ && std::equal(cbegin(), cend(), other.cbegin());
+        }
+
+        bool operator!=(const UnrolledXORList &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        auto get_allocator() const noexcept
+        {
+            return Allocator(alloc_);
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(nullptr, m_head_, 0, this);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return cbegin();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(nullptr, m_head_, 0, this);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(m_tail_, nullptr, 0, this);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return cend();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(m_tail_, nullptr, 0, this);
+        }
+
+        bool empty() const noexcept
+        {
+            return m_size_ == 0;
+        }
+
+        size_t size() const noexcept
+        {
+            return m_size_;
+        }
+
+        size_t max_size() const noexcept
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+
+        // Capacity of a single node.
+        static constexpr size_t node_capacity() noexcept
+        {
+            return N;
+        }
+
+        void clear() noexcept
+        {
+            Node *prev = nullptr;
+            Node *current = m_head_;
+            while (current != nullptr)
+            {
+                Node *next = XOR(prev, current->npx);
+                deallocate_node(current);
+                prev = current;
+                current = next;
+            }
+
+            m_head_ = m_tail_ = nullptr;
+            m_size_ = 0;
+        }
+
+        T &front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return element(m_head_, 0); // undefined behavior on an empty NoThrow list
+        }
+
+        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return const_cast<UnrolledXORList *>(this)->front();
+        }
+
+        T &back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return element(m_tail_, m_tail_->count - 1); // undefined behavior on an empty NoThrow list
+        }
+
+        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return const_cast<UnrolledXORList *>(this)->back();
+        }
+
+        template <class... Args>
+        T &emplace_back(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (m_tail_ == nullptr || m_tail_->count == N)
+            {
+                link_between(m_tail_, nullptr, make_node(false, std::forward<Args>(args)...));
+            }
+            else
+            {
+                node_insert(m_tail_, m_tail_->count, std::forward<Args>(args)...);
+            }
+            ++m_size_;
+            return element(m_tail_, m_tail_->count - 1);
+        }
+
+        template <class... Args>
+        T &emplace_front(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (m_head_ == nullptr || m_head_->count == N)
+            {
+                // A node opened by a front push is read backwards so further front pushes append to its ring.
+                link_between(nullptr, m_head_, make_node(true, std::forward<Args>(args)...));
+            }
+            else
+            {
+                node_insert(m_head_, 0, std::forward<Args>(args)...);
+            }
+            ++m_size_;
+            return element(m_head_, 0);
+        }
+
+        void push_back(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(std::move(value));
+        }
+
+        void push_front(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(value);
+        }
+
+        void push_front(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(std::move(value));
+        }
+
+        void pop_back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            node_erase(m_tail_, m_tail_->count - 1);
+            if (m_tail_->count == 0)
+            {
+                Node *temp = m_tail_;
+                unlink(XOR(temp->npx, nullptr), temp);
+                deallocate_node(temp);
+            }
+            --m_size_;
+        }
+
+        void pop_front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            node_erase(m_head_, 0);
+            if (m_head_->count == 0)
+            {
+                Node *temp = m_head_;
+                unlink(nullptr, temp);
+                deallocate_node(temp);
+            }
+            --m_size_;
+        }
+
+        iterator insert(const_iterator pos, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            size_t index = pos.index_;
+
+            if (current == nullptr)
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return iterator(XOR(m_tail_->npx, nullptr), m_tail_, m_tail_->count - 1, this);
+            }
+
+            if (current->count == N)
+            {
+                if (index == 0 && prev != nullptr && prev->count < N)
+                {
+                    // Room at the end of the previous node saves a split.
+                    node_insert(prev, prev->count, std::forward<Args>(args)...);
+                    ++m_size_;
+                    return iterator(XOR(prev->npx, current), prev, prev->count - 1, this);
+                }
+
+                Node *upper = split_node(prev, current, N / 2);
+                if (index > N / 2)
+                {
+                    prev = current;
+                    current = upper;
+                    index -= N / 2;
+                }
+            }
+
+            node_insert(current, index, std::forward<Args>(args)...);
+            ++m_size_;
+            return iterator(prev, current, index, this);
+        }
+
+        iterator erase(const_iterator pos) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (pos == cend())
+            {
+                return end();
+            }
+
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            size_t index = pos.index_;
+
+            node_erase(current, index);
+            --m_size_;
+
+            if (current->count == 0)
+            {
+                Node *next = XOR(prev, current->npx);
+                unlink(prev, current);
+                deallocate_node(current);
+                return iterator(prev, next, 0, this);
+            }
+
+            absorb_next(prev, current);
+            if (index < current->count)
+            {
+                return iterator(prev, current, index, this);
+            }
+            return iterator(current, XOR(prev, current->npx), 0, this);
+        }
+
+        // Moves every element of `other` in front of `pos` without copying them. At most one node of this list
+        // is split; when the two lists disagree on orientation the nodes of `other` are re-flagged one by one.
+        void splice(const_iterator pos, UnrolledXORList &other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (other.empty() || &other == this)
+            {
+                return;
+            }
+
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            if (current != nullptr && pos.index_ != 0)
+            {
+                prev = current;
+                current = split_node(const_cast<Node *>(pos.prev_), prev, pos.index_);
+            }
+
+            if (other.m_reversed_ != m_reversed_)
+            {
+                for (Node *node = other.m_head_, *before = nullptr, *after; node != nullptr; before = node, node = after)
+                {
+                    after = XOR(before, node->npx);
+                    node->flipped = !node->flipped;
+                }
+            }
+
+            other.m_head_->npx = XOR(other.m_head_->npx, prev);
+            other.m_tail_->npx = XOR(other.m_tail_->npx, current);
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(XOR(prev->npx, current), other.m_head_);
+            }
+            else
+            {
+                m_head_ = other.m_head_;
+            }
+            if (current != nullptr)
+            {
+                current->npx = XOR(XOR(current->npx, prev), other.m_tail_);
+            }
+            else
+            {
+                m_tail_ = other.m_tail_;
+            }
+
+            m_size_ += other.m_size_;
+            other.m_head_ = other.m_tail_ = nullptr;
+            other.m_size_ = 0;
+        }
+
+        void reverse() noexcept
+        {
+            std::swap(m_head_, m_tail_);
+            m_reversed_ = !m_reversed_;
+        }
+
+        void swap(UnrolledXORList &other) noexcept
+        {
+            using std::swap;
+
+            if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_swap::value)
+            {
+                swap(alloc_, other.alloc_);
+            }
+
+            swap(m_head_, other.m_head_);
+            swap(m_tail_, other.m_tail_);
+            swap(m_size_, other.m_size_);
+            swap(m_reversed_, other.m_reversed_);
+        }
+    };
+}
+
+#endif // _SCC_UNROLLED_XORLIST_HPP_
@@ -3,13 +3,28 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <iterator>
 #include <type_traits>
 #include <limits>
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <initializer_list>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace scc
 {
@@ -19,6 +34,115 @@ namespace scc
         Throw,
     };
 
+    namespace detail
+    {
+        // An allocator opts in with `using piecewise_deallocation = std::true_type;` when the block returned by
+        // allocate(n) may be given back one element at a time, which lets XORList allocate nodes in batches.
+        template <typename Alloc, typename = void>
+        struct piecewise_deallocation : std::false_type
+        {
+        };
+
+        template <typename Alloc>
+        struct piecewise_deallocation<Alloc, std::void_t<typename Alloc::piecewise_deallocation>>
+            : Alloc::piecewise_deallocation
+        {
+        };
+
+        // Hints the hardware to start loading `address` into the cache; a no-op where the compiler has no builtin.
+        inline void prefetch(const void *address) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#else
+            (void)address;
+#endif
+        }
+
+        // An allocator that can take back everything it handed out in one step provides `bool release_all()`,
+        // returning false when it cannot (for example because other owners still use its storage).
+        template <typename Alloc, typename = void>
+        struct has_release_all : std::false_type
+        {
+        };
+
+        template <typename Alloc>
+        struct has_release_all<Alloc, std::void_t<decltype(std::declval<Alloc &>().release_all())>> : std::true_type
+        {
+        };
+
+        // Stream header written by XORList::write_to: magic, element size (0 when a codec encodes the elements)
+        // and element count.
+        inline constexpr char kStreamMagic[4] = {'X', 'O', 'R', 'L'};
+        inline constexpr size_t kStreamBlockBytes = 64 * 1024;
+
+        // Read-only stream buffer over a block of memory, for the buffer overloads of XORList::read_from.
+        class MemoryReadBuffer : public std::streambuf
+        {
+        public:
+            MemoryReadBuffer(const void *data, size_t size)
+            {
+                char *begin = const_cast<char *>(static_cast<const char *>(data));
+                setg(begin, begin, begin + size);
+            }
+
+            size_t consumed() const
+            {
+                return static_cast<size_t>(gptr() - eback());
+            }
+        };
+
+        // Stream buffer appending to a byte vector, for the buffer overloads of XORList::write_to.
+        class VectorWriteBuffer : public std::streambuf
+        {
+        private:
+            std::vector<unsigned char> &out_;
+
+        protected:
+            std::streamsize xsputn(const char *data, std::streamsize count) override
+            {
+                out_.insert(out_.end(), data, data + count);
+                return count;
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    out_.push_back(static_cast<unsigned char>(ch));
+                }
+                return traits_type::not_eof(ch);
+            }
+
+        public:
+            explicit VectorWriteBuffer(std::vector<unsigned char> &out) : out_(out) {}
+        };
+    } // namespace detail
+
+    // Default element codec of XORList::write_to/read_from: the bytes of a trivially copyable T, which XORList
+    // streams in large blocks instead of calling encode/decode per element. A custom codec provides
+    // `void encode(std::ostream &, const T &) const` and `T decode(std::istream &) const`.
+    template <typename T>
+    struct RawCodec
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "RawCodec needs a trivially copyable T; pass a codec for other types");
+
+        void encode(std::ostream &out, const T &value) const
+        {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        T decode(std::istream &in) const
+        {
+            alignas(T) unsigned char storage[sizeof(T)] = {};
+            in.read(reinterpret_cast<char *>(storage), sizeof(T));
+            return *std::launder(reinterpret_cast<T *>(storage));
+        }
+    };
+
+    template <typename T, CanThrow canThrow = CanThrow::NoThrow, typename Allocator = std::allocator<T>>
+    class FrozenXORList;
+
     template <typename T, CanThrow canThrow = CanThrow::NoThrow, typename Allocator = std::allocator<T>>
     class XORList
     {
@@ -28,7 +152,32 @@ namespace scc
             T data;
             Node *npx; // XOR of next and previous node pointers
 
-            Node(T value) : data(value), npx(nullptr) {}
+            template <class... Args>
+            explicit Node(Args &&...args) : data(std::forward<Args>(args)...), npx(nullptr) {}
+        };
+
+        // A detached run of nodes: head->npx holds only its successor and tail->npx only its predecessor.
+        struct Chain
+        {
+            Node *head;
+            Node *tail;
+        };
+
+        // Optional sparse index: every stride-th node together with its predecessor, so positions are found by
+        // jumping to a checkpoint and walking at most stride - 1 nodes. Appends and pops at the back keep it current;
+        // any other structural change marks it stale and the next positional query rebuilds it in one pass.
+        struct PositionIndex
+        {
+            struct Checkpoint
+            {
+                Node *prev;
+                Node *node;
+            };
+
+            size_t stride;
+            bool stale;
+            std::vector<Checkpoint> checkpoints;
+            std::unordered_map<const Node *, size_t> slots; // checkpoint node -> its slot in `checkpoints`
         };
 
         Node *m_head_;
@@ -36,8 +185,21 @@ namespace scc
         size_t m_size_;
         using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
         NodeAllocator alloc_;
+        std::unique_ptr<PositionIndex> m_index_;
+
+        // Change counters that cursors and compactors compare against. They live off the list, allocated by the first
+        // make_cursor() or make_compactor(), so lists that never hand one out do not pay for them; changes made
+        // before then need no record. Atomic only because a const make_cursor() may allocate it.
+        struct Tracking
+        {
+            size_t version = 1;     // bumped by note_reshape(); cursors re-seek when it moves. A cursor that last
+                                    // moved before the counters existed holds 0, so it re-seeks too.
+            size_t front_shift = 0; // net elements added at the front, so cursors can keep their position
+        };
+
+        mutable std::atomic<Tracking *> m_tracking_{nullptr};
 
-        Node *XOR(Node *a, Node *b)
+        Node *XOR(Node *a, Node *b) const
         {
             return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b));
         }
@@ -47,10 +209,20 @@ namespace scc
             return reinterpret_cast<const Node *>(reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b));
         }
 
-        Node *allocate_node(const T &value)
+        // Constructs the element directly inside the node; nothing is copied or moved on the way.
+        template <class... Args>
+        Node *allocate_node(Args &&...args)
         {
             Node *newNode = std::allocator_traits<NodeAllocator>::allocate(alloc_, 1);
-            std::allocator_traits<NodeAllocator>::construct(alloc_, newNode, value);
+            try
+            {
+                std::allocator_traits<NodeAllocator>::construct(alloc_, newNode, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator_traits<NodeAllocator>::deallocate(alloc_, newNode, 1);
+                throw;
+            }
             return newNode;
         }
 
@@ -60,1105 +232,3276 @@ namespace scc
             std::allocator_traits<NodeAllocator>::deallocate(alloc_, node, 1);
         }
 
-    public:
-        explicit XORList(const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator) {}
+        // Destroys and frees every node of a detached chain.
+        void deallocate_chain(Chain chain) noexcept
+        {
+            for (Node *current = chain.head, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+            {
+                next = XOR(prev, current->npx);
+                deallocate_node(current);
+            }
+        }
 
-        XORList(size_t count, const T &value, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        // Appends a constructed node to a detached chain.
+        void chain_back(Chain &chain, Node *node) noexcept
         {
-            for (size_t i = 0; i < count; ++i)
+            node->npx = chain.tail;
+            if (chain.tail != nullptr)
             {
-                push_back(value);
+                chain.tail->npx = XOR(chain.tail->npx, node);
             }
+            else
+            {
+                chain.head = node;
+            }
+            chain.tail = node;
         }
 
-        explicit XORList(size_t count, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        // Builds a detached chain of `length` nodes, constructing each element with `construct_at(node)`. With an
+        // allocator that supports it, all nodes come from a single allocate(length) call. If an element constructor
+        // throws, everything built so far is freed again.
+        template <class ConstructAt>
+        Chain build_counted_chain(size_t length, ConstructAt construct_at)
         {
-            for (size_t i = 0; i < count; ++i)
+            Chain chain = {nullptr, nullptr};
+            if (length == 0)
+            {
+                return chain;
+            }
+
+            if constexpr (detail::piecewise_deallocation<NodeAllocator>::value)
+            {
+                Node *block = std::allocator_traits<NodeAllocator>::allocate(alloc_, length);
+                size_t built = 0;
+                try
+                {
+                    for (; built < length; ++built)
+                    {
+                        construct_at(block + built);
+                        chain_back(chain, block + built);
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_chain(chain);
+                    std::allocator_traits<NodeAllocator>::deallocate(alloc_, block + built, length - built);
+                    throw;
+                }
+            }
+            else
             {
-                push_back(T());
+                try
+                {
+                    for (size_t built = 0; built < length; ++built)
+                    {
+                        Node *node = std::allocator_traits<NodeAllocator>::allocate(alloc_, 1);
+                        try
+                        {
+                            construct_at(node);
+                        }
+                        catch (...)
+                        {
+                            std::allocator_traits<NodeAllocator>::deallocate(alloc_, node, 1);
+                            throw;
+                        }
+                        chain_back(chain, node);
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_chain(chain);
+                    throw;
+                }
             }
+            return chain;
         }
 
-        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
-        XORList(InputIt first, InputIt last, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        // Builds a detached chain from [first, last) in one pass and adds its length to `count`. Forward ranges
+        // are measured first so they can go through build_counted_chain(); single-pass input is built node by node.
+        template <class InputIt>
+        Chain build_chain(InputIt first, InputIt last, size_t &count)
         {
-            for (InputIt it = first; it != last; ++it)
+            using Category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+            {
+                size_t length = static_cast<size_t>(std::distance(first, last));
+                auto construct_next = [&](Node *node)
+                {
+                    std::allocator_traits<NodeAllocator>::construct(alloc_, node, *first);
+                    ++first;
+                };
+                Chain chain = build_counted_chain(length, construct_next);
+                count += length;
+                return chain;
+            }
+            else
             {
-                push_back(*it);
+                Chain chain = {nullptr, nullptr};
+                try
+                {
+                    for (; first != last; ++first)
+                    {
+                        chain_back(chain, allocate_node(*first));
+                        ++count;
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_chain(chain);
+                    throw;
+                }
+                return chain;
             }
         }
 
-        XORList(const XORList &other) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(std::allocator_traits<NodeAllocator>::select_on_container_copy_construction(other.alloc_))
+        // Builds a detached chain of `length` elements, each constructed from `args`.
+        template <class... Args>
+        Chain build_chain_n(size_t length, const Args &...args)
         {
-            for (Node *current = other.m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+            auto construct_copy = [&](Node *node)
+            {
+                std::allocator_traits<NodeAllocator>::construct(alloc_, node, args...);
+            };
+            return build_counted_chain(length, construct_copy);
+        }
+
+        // Assigns over the existing elements in place, then frees the surplus nodes or builds the missing ones as
+        // one chain, so assigning between lists of similar length allocates nothing.
+        template <class InputIt>
+        void assign_range(InputIt first, InputIt last)
+        {
+            size_t kept = 0;
+            for (Node *current = m_head_, *prev = nullptr, *next; current != nullptr && first != last; prev = current, current = next)
             {
                 next = XOR(prev, current->npx);
-                push_back(current->data);
+                current->data = *first;
+                ++first;
+                ++kept;
+            }
+
+            if (kept < m_size_)
+            {
+                truncate(kept);
+            }
+            else
+            {
+                append_range(first, last);
             }
         }
 
-        XORList(XORList &&other) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(other.m_head_), m_tail_(other.m_tail_), m_size_(other.m_size_), alloc_(std::move(other.alloc_))
+        // Drops every element from `count` on.
+        void truncate(size_t count)
         {
-            other.m_head_ = other.m_tail_ = nullptr;
-            other.m_size_ = 0;
+            refresh_index();
+            auto cut = seek(count);
+            Chain dropped = unlink_range(cut.first, cut.second, m_tail_, nullptr);
+            m_size_ = count;
+            deallocate_chain(dropped);
         }
 
-        XORList(std::initializer_list<T> init, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
-            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        // Links a freshly built chain of `count` nodes in front of `next`, whose predecessor is `prev`.
+        void link_built_chain(Node *prev, Node *next, Chain chain, size_t count) noexcept
         {
-            for (const T &value : init)
+            if (chain.head != nullptr)
             {
-                push_back(value);
+                link_chain(prev, next, chain);
+                m_size_ += count;
             }
         }
 
-        bool operator==(const XORList &other) const noexcept
+        // Called by every structural change other than push/emplace at either end and pop_back, which keep the
+        // index and cursors current on their own.
+        void note_reshape() noexcept
         {
-            if (m_size_ != other.m_size_)
+            bump_version();
+            if (m_index_ != nullptr)
             {
-                return false;
+                m_index_->stale = true;
             }
+        }
 
-            const Node *current = m_head_;
-            const Node *prev = nullptr;
-            const Node *next;
-
-            const Node *other_current = other.m_head_;
-            const Node *other_prev = nullptr;
-            const Node *other_next;
+        // Rebuilds a stale index with one walk over the list. Only non-const members call this, so const queries
+        // never write to the index; if memory runs out the index just stays stale.
+        void refresh_index() noexcept
+        {
+            if (m_index_ == nullptr || !m_index_->stale)
+            {
+                return;
+            }
 
-            while (current != nullptr && other_current != nullptr)
+            PositionIndex &index = *m_index_;
+            try
             {
-                if (current->data != other_current->data)
+                index.checkpoints.clear();
+                index.slots.clear();
+                index.checkpoints.reserve(m_size_ / index.stride + 1);
+                index.slots.reserve(m_size_ / index.stride + 1);
+
+                size_t position = 0;
+                for (Node *current = m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next, ++position)
                 {
-                    return false;
+                    next = XOR(prev, current->npx);
+                    if (position % index.stride == 0)
+                    {
+                        index.slots.emplace(current, index.checkpoints.size());
+                        index.checkpoints.push_back({prev, current});
+                    }
                 }
-
-                next = XOR(prev, current->npx);
-                other_next = XOR(other_prev, other_current->npx);
-
-                prev = current;
-                current = next;
-
-                other_prev = other_current;
-                other_current = other_next;
+                index.stale = false;
+            }
+            catch (...)
+            {
+                index.checkpoints.clear();
+                index.slots.clear();
             }
+        }
 
-            return current == nullptr && other_current == nullptr;
+        // The index if it is enabled and current, else null; positional queries walk from the nearer end without it.
+        const PositionIndex *ready_index() const noexcept
+        {
+            return m_index_ != nullptr && !m_index_->stale ? m_index_.get() : nullptr;
         }
 
-        bool operator!=(const XORList &other) const noexcept
+        Tracking *tracking() const noexcept
         {
-            return !(*this == other);
+            return m_tracking_.load(std::memory_order_acquire);
         }
 
-        ~XORList()
+        void bump_version() noexcept
         {
-            clear();
+            if (Tracking *counters = tracking())
+            {
+                ++counters->version;
+            }
         }
 
-        XORList &operator=(const XORList &other) noexcept(canThrow == CanThrow::NoThrow)
+        // Allocates the change counters on first use. Concurrent const callers race on the compare-exchange and the
+        // loser frees its copy. Null if memory runs out; cursors then re-seek on every move.
+        Tracking *start_tracking() const noexcept
         {
-            if (this != &other)
+            Tracking *counters = tracking();
+            if (counters == nullptr)
             {
-                clear();
-                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_copy_assignment::value)
+                Tracking *fresh = new (std::nothrow) Tracking();
+                if (fresh == nullptr)
                 {
-                    alloc_ = other.alloc_;
+                    return nullptr;
                 }
-                for (Node *current = other.m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+                if (m_tracking_.compare_exchange_strong(counters, fresh, std::memory_order_acq_rel))
                 {
-                    next = XOR(prev, current->npx);
-                    push_back(current->data);
+                    return fresh;
                 }
+                delete fresh;
             }
-            return *this;
+            return counters;
         }
 
-        XORList &operator=(XORList &&other) noexcept(canThrow == CanThrow::NoThrow)
+        // Finds the position of the node an iterator refers to by walking it to the next checkpoint, at most stride
+        // steps. Fails when the index is disabled or stale, or the iterator walks backwards (one derived from
+        // rbegin()).
+        bool locate(const Node *prev, const Node *current, size_t &position) const
         {
-            if (this != &other)
+            const PositionIndex *ready = ready_index();
+            if (ready == nullptr)
             {
-                clear();
-                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_move_assignment::value)
+                return false;
+            }
+
+            const PositionIndex &index = *ready;
+            for (size_t steps = 0;; ++steps)
+            {
+                if (current == nullptr)
                 {
-                    alloc_ = std::move(other.alloc_);
+                    if (prev != m_tail_)
+                    {
+                        return false;
+                    }
+                    position = m_size_ - steps;
+                    return true;
                 }
-                else if (alloc_ != other.alloc_)
+
+                auto slot = index.slots.find(current);
+                if (slot != index.slots.end())
                 {
-                    for (Node *current = other.m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+                    if (index.checkpoints[slot->second].prev != prev)
                     {
-                        next = XOR(prev, current->npx);
-                        push_back(std::move(current->data));
+                        return false;
                     }
-                    other.clear();
-                    return *this;
+                    position = slot->second * index.stride - steps;
+                    return true;
                 }
-                m_head_ = other.m_head_;
-                m_tail_ = other.m_tail_;
-                m_size_ = other.m_size_;
 
-                other.m_head_ = other.m_tail_ = nullptr;
-                other.m_size_ = 0;
+                const Node *next = XOR(prev, current->npx);
+                prev = current;
+                current = next;
             }
-            return *this;
         }
 
-        XORList &operator=(std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
+        // Returns the (prev, current) pair at `position` (at most m_size_). Walks from whichever anchor is nearer:
+        // the head or tail without a current index, the checkpoints on either side of `position` with one.
+        std::pair<Node *, Node *> seek(size_t position) const
         {
-            clear();
-            for (const T &value : ilist)
+            if (position >= m_size_)
             {
-                push_back(value);
+                return {m_tail_, nullptr};
             }
-            return *this;
-        }
 
-        void assign(size_t count, const T &value) noexcept(canThrow == CanThrow::NoThrow)
-        {
-            clear();
-            for (size_t i = 0; i < count; ++i)
-            {
-                push_back(value);
+            Node *prev = nullptr;
+            Node *current = m_head_;
+            size_t ahead = position; // forward steps from `current`
+            Node *back = m_tail_; // anchor for walking backwards, at `back_position`
+            Node *back_next = nullptr;
+            size_t back_position = m_size_ - 1;
+            if (const PositionIndex *ready = ready_index())
+            {
+                const PositionIndex &index = *ready;
+                size_t slot = position / index.stride;
+                prev = index.checkpoints[slot].prev;
+                current = index.checkpoints[slot].node;
+                ahead = position % index.stride;
+                if (slot + 1 < index.checkpoints.size())
+                {
+                    back = index.checkpoints[slot + 1].node;
+                    back_next = XOR(index.checkpoints[slot + 1].prev, back->npx);
+                    back_position = (slot + 1) * index.stride;
+                }
             }
-        }
 
-        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
-        void assign(InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
-        {
-            clear();
-            for (InputIt it = first; it != last; ++it)
+            if (back_position - position < ahead)
             {
-                push_back(*it);
+                for (size_t steps = back_position - position; steps > 0; --steps)
+                {
+                    Node *before = XOR(back->npx, back_next);
+                    back_next = back;
+                    back = before;
+                }
+                return {XOR(back->npx, back_next), back};
             }
-        }
 
-        void assign(std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
-        {
-            clear();
-            for (const T &value : ilist)
+            for (; ahead > 0; --ahead)
             {
-                push_back(value);
+                Node *next = XOR(prev, current->npx);
+                prev = current;
+                current = next;
             }
+            return {prev, current};
         }
 
-        auto get_allocator() const noexcept
-        {
-            return Allocator(alloc_);
-        }
-
-        T &front() noexcept(canThrow == CanThrow::NoThrow)
+        void link_back(Node *newNode) noexcept
         {
-            if (empty())
+            if (m_index_ != nullptr && !m_index_->stale && m_size_ % m_index_->stride == 0)
             {
-                if constexpr (canThrow == CanThrow::Throw)
+                try
                 {
-                    throw std::runtime_error("List is empty");
+                    m_index_->slots.emplace(newNode, m_index_->checkpoints.size());
+                    m_index_->checkpoints.push_back({m_tail_, newNode});
                 }
-                else
+                catch (...)
                 {
-                    return m_tail_->data; // undefined behavior
+                    m_index_->stale = true;
                 }
             }
-            return m_head_->data;
-        }
 
-        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
-        {
-            if (empty())
+            newNode->npx = m_tail_;
+
+            if (m_tail_ != nullptr)
             {
-                if constexpr (canThrow == CanThrow::Throw)
-                {
-                    throw std::runtime_error("List is empty");
-                }
-                else
-                {
-                    return m_tail_->data; // undefined behavior
-                }
+                m_tail_->npx = XOR(newNode, m_tail_->npx);
             }
-            return m_head_->data;
+            else
+            {
+                m_head_ = newNode;
+            }
+
+            m_tail_ = newNode;
+            ++m_size_;
         }
 
-        T &back() noexcept(canThrow == CanThrow::NoThrow)
+        void link_front(Node *newNode) noexcept
         {
-            if (empty())
+            if (Tracking *counters = tracking())
             {
-                if constexpr (canThrow == CanThrow::Throw)
+                ++counters->front_shift;
+            }
+            if (m_index_ != nullptr)
+            {
+                m_index_->stale = true;
+            }
+            newNode->npx = m_head_;
+
+            if (m_head_ != nullptr)
+            {
+                m_head_->npx = XOR(newNode, m_head_->npx);
+            }
+            else
+            {
+                m_tail_ = newNode;
+            }
+
+            m_head_ = newNode;
+            ++m_size_;
+        }
+
+
+        // Appends `other` to the end of `into` in O(1).
+        void append_chain(Chain &into, Chain other) noexcept
+        {
+            if (other.head == nullptr)
+            {
+                return;
+            }
+            if (into.head == nullptr)
+            {
+                into = other;
+                return;
+            }
+
+            into.tail->npx = XOR(into.tail->npx, other.head);
+            other.head->npx = XOR(other.head->npx, into.tail);
+            into.tail = other.tail;
+        }
+
+        // Detaches the nodes [first, last) into a chain; `first_prev` and `last_prev` are their predecessors.
+        Chain unlink_range(Node *first_prev, Node *first, Node *last_prev, Node *last) noexcept
+        {
+            note_reshape();
+            if (first_prev != nullptr)
+            {
+                first_prev->npx = XOR(XOR(first_prev->npx, first), last);
+            }
+            else
+            {
+                m_head_ = last;
+            }
+            if (last != nullptr)
+            {
+                last->npx = XOR(XOR(last->npx, last_prev), first_prev);
+            }
+            else
+            {
+                m_tail_ = first_prev;
+            }
+
+            first->npx = XOR(first->npx, first_prev);
+            last_prev->npx = XOR(last_prev->npx, last);
+            return Chain{first, last_prev};
+        }
+
+        // Links a detached chain between the adjacent nodes `prev` and `next` (either may be null at the ends).
+        void link_chain(Node *prev, Node *next, Chain chain) noexcept
+        {
+            note_reshape();
+            chain.head->npx = XOR(chain.head->npx, prev);
+            chain.tail->npx = XOR(chain.tail->npx, next);
+
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(XOR(prev->npx, next), chain.head);
+            }
+            else
+            {
+                m_head_ = chain.head;
+            }
+            if (next != nullptr)
+            {
+                next->npx = XOR(XOR(next->npx, prev), chain.tail);
+            }
+            else
+            {
+                m_tail_ = chain.tail;
+            }
+        }
+
+        // Moves up to `budget` elements starting at `current` (preceded by `prev`) into freshly allocated nodes, in
+        // list order and, where the allocator allows it, from a single block. Returns the (prev, current) pair
+        // after the relocated run. If an element's copy throws, the list is left as it was.
+        std::pair<Node *, Node *> relocate_run(Node *prev, Node *current, size_t budget)
+        {
+            Node *last_prev = prev;
+            Node *last = current;
+            size_t count = 0;
+            for (; last != nullptr && count < budget; ++count)
+            {
+                Node *next = XOR(last_prev, last->npx);
+                last_prev = last;
+                last = next;
+            }
+            if (count == 0)
+            {
+                return {prev, current};
+            }
+
+            Node *from_prev = prev;
+            Node *from = current;
+            auto move_next = [&](Node *node)
+            {
+                std::allocator_traits<NodeAllocator>::construct(alloc_, node, std::move_if_noexcept(from->data));
+                Node *next = XOR(from_prev, from->npx);
+                from_prev = from;
+                from = next;
+            };
+            Chain fresh = build_counted_chain(count, move_next);
+
+            Chain old = unlink_range(prev, current, last_prev, last);
+            link_chain(prev, last, fresh);
+            deallocate_chain(old);
+            return {fresh.tail, last};
+        }
+
+        // Visits nodes from the head until `visit(node)` returns true and returns the (prev, current) pair there.
+        // A second pair runs `distance` nodes ahead and prefetches each node it reaches, so by the time the visit
+        // gets to a node its npx and element are usually in cache and the visit's work overlaps the misses.
+        template <class Visit>
+        std::pair<const Node *, const Node *> walk_prefetching(Visit visit, size_t distance) const
+        {
+            const Node *ahead_prev = nullptr;
+            const Node *ahead = m_head_;
+            for (size_t i = 0; i < distance && ahead != nullptr; ++i)
+            {
+                const Node *next = XOR(ahead_prev, ahead->npx);
+                ahead_prev = ahead;
+                ahead = next;
+                if (ahead != nullptr)
                 {
-                    throw std::runtime_error("List is empty");
+                    detail::prefetch(ahead);
                 }
-                else
+            }
+
+            for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+            {
+                if (ahead != nullptr)
                 {
-                    return m_tail_->data; // undefined behavior
+                    const Node *ahead_next = XOR(ahead_prev, ahead->npx);
+                    ahead_prev = ahead;
+                    ahead = ahead_next;
+                    if (ahead != nullptr)
+                    {
+                        detail::prefetch(ahead);
+                    }
+                }
+                if (visit(current))
+                {
+                    return {prev, current};
                 }
+                next = XOR(prev, current->npx);
             }
-            return m_tail_->data;
+            return {m_tail_, nullptr};
         }
 
-        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        // Walks inward from both ends at once, so each step issues two independent loads instead of one. A match
+        // found by the front cursor is the first one; a match found by the back cursor is only the best so far,
+        // and the walk goes on until the cursors meet in case the front half holds an earlier one.
+        template <class Match>
+        std::pair<const Node *, const Node *> walk_bidirectional(Match match) const
         {
-            if (empty())
-            {
-                if constexpr (canThrow == CanThrow::Throw)
+            std::pair<const Node *, const Node *> found{m_tail_, nullptr};
+            const Node *front_prev = nullptr;
+            const Node *front = m_head_;
+            const Node *back_next = nullptr;
+            const Node *back = m_tail_;
+            for (size_t low = 0, high = m_size_; low < high; ++low)
+            {
+                if (match(front))
                 {
-                    throw std::runtime_error("List is empty");
+                    return {front_prev, front};
                 }
-                else
+                const Node *front_next = XOR(front_prev, front->npx);
+                front_prev = front;
+                front = front_next;
+
+                if (--high == low)
                 {
-                    return m_tail_->data; // undefined behavior
+                    break;
+                }
+                const Node *back_prev = XOR(back_next, back->npx);
+                if (match(back))
+                {
+                    found = {back_prev, back};
                 }
+                back_next = back;
+                back = back_prev;
             }
-            return m_tail_->data;
+            return found;
         }
 
-        template <bool IsConst>
-        class XORListIterator
+        // A run of `count` nodes starting at `first`, handed to one thread by the parallel algorithms.
+        struct Span
         {
-        private:
-            using NodeType = std::conditional_t<IsConst, const Node, Node>;
-            using XORListType = std::conditional_t<IsConst, const XORList, XORList>;
+            const Node *prev;
+            const Node *first;
+            size_t count;
+        };
 
-            NodeType *prev_;
-            NodeType *current_;
-            XORListType *list_;
+        // Runs shorter than this are not worth a thread of their own.
+        static constexpr size_t kParallelMinSpan = 4096;
 
-            friend class XORList<T, canThrow, Allocator>;
+        // Cuts the list into at most `parts` spans of about equal length. With a current index the cuts are taken from
+        // its checkpoints without a walk; otherwise one walk up to the last cut collects them.
+        std::vector<Span> split_spans(size_t parts) const
+        {
+            std::vector<Span> spans;
+            parts = std::max<size_t>(1, std::min(parts, m_size_ / kParallelMinSpan));
+            if (m_size_ == 0)
+            {
+                return spans;
+            }
+            spans.reserve(parts);
 
-        public:
-            using iterator_category = std::bidirectional_iterator_tag;
-            using value_type = T;
-            using difference_type = std::ptrdiff_t;
-            using pointer = std::conditional_t<IsConst, const T *, T *>;
-            using reference = std::conditional_t<IsConst, const T &, T &>;
+            if (const PositionIndex *ready = ready_index())
+            {
+                const PositionIndex &index = *ready;
+                size_t slots = index.checkpoints.size();
+                size_t start = 0;
+                for (size_t part = 1; part <= parts; ++part)
+                {
+                    size_t end = part * slots / parts;
+                    if (end == start)
+                    {
+                        continue;
+                    }
+                    size_t end_position = end == slots ? m_size_ : end * index.stride;
+                    spans.push_back({index.checkpoints[start].prev, index.checkpoints[start].node, end_position - start * index.stride});
+                    start = end;
+                }
+                return spans;
+            }
 
-            XORListIterator(NodeType *prev, NodeType *current, XORListType *list)
-                : prev_(prev), current_(current), list_(list) {}
+            size_t part = 0;
+            size_t start = 0;
+            const Node *start_prev = nullptr;
+            const Node *start_node = m_head_;
+            size_t position = 0;
+            for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr && part + 1 < parts; prev = current, current = next, ++position)
+            {
+                if (position == (part + 1) * m_size_ / parts)
+                {
+                    spans.push_back({start_prev, start_node, position - start});
+                    start = position;
+                    start_prev = prev;
+                    start_node = current;
+                    ++part;
+                }
+                next = XOR(prev, current->npx);
+            }
+            spans.push_back({start_prev, start_node, m_size_ - start});
+            return spans;
+        }
 
-            reference operator*() const { return current_->data; }
-            pointer operator->() const { return &(current_->data); }
+        static size_t parallel_threads(size_t threads) noexcept
+        {
+            return threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+        }
 
-            XORListIterator &operator++()
+        // Non-const parallel calls keep their split points in the index, so only the first call after a structural
+        // change walks the list: a list without an index gets one with a checkpoint every kParallelMinSpan nodes
+        // (one checkpoint per 4096 elements), and a stale one is rebuilt. If memory runs out the calls walk instead.
+        void prepare_parallel() noexcept
+        {
+            if (m_index_ == nullptr && m_size_ >= 2 * kParallelMinSpan)
             {
-                if (current_ == nullptr)
+                try
                 {
-                    return *this; // Already at end, do nothing
+                    m_index_ = std::make_unique<PositionIndex>();
                 }
-
-                NodeType *next = list_->XOR(prev_, current_->npx);
-                prev_ = current_;
-                current_ = next;
-                return *this;
+                catch (...)
+                {
+                    return;
+                }
+                m_index_->stride = kParallelMinSpan;
+                m_index_->stale = true;
             }
+            refresh_index();
+        }
 
-            XORListIterator operator++(int)
+        // Calls `work(spans[i], i)` for every span, the first on the calling thread and the rest on threads of their
+        // own, and rethrows the first exception any of them raised once all have finished. A span whose thread cannot
+        // be started runs on the calling thread instead.
+        template <class Work>
+        void run_parallel(const std::vector<Span> &spans, Work &work) const
+        {
+            std::vector<std::exception_ptr> errors(spans.size());
+            auto guarded = [&](size_t i)
             {
-                XORListIterator temp = *this;
-                ++(*this);
-                return temp;
-            }
+                try
+                {
+                    work(spans[i], i);
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
 
-            XORListIterator &operator--()
+            std::vector<std::thread> workers;
+            workers.reserve(spans.size());
+            for (size_t i = 1; i < spans.size(); ++i)
             {
-                if (prev_ == nullptr)
+                try
                 {
-                    return *this; // Already at begin, do nothing
+                    workers.emplace_back(guarded, i);
+                }
+                catch (const std::system_error &)
+                {
+                    guarded(i);
+                }
+            }
+            if (!spans.empty())
+            {
+                guarded(0);
+            }
+            for (std::thread &worker : workers)
+            {
+                worker.join();
+            }
+            for (const std::exception_ptr &error : errors)
+            {
+                if (error != nullptr)
+                {
+                    std::rethrow_exception(error);
                 }
+            }
+        }
 
-                NodeType *next = list_->XOR(prev_->npx, current_);
-                current_ = prev_;
-                prev_ = next;
-                return *this;
+        template <class Visit>
+        void walk_span(const Span &span, Visit &visit) const
+        {
+            const Node *prev = span.prev;
+            const Node *current = span.first;
+            for (size_t i = 0; i < span.count; ++i)
+            {
+                visit(current);
+                const Node *next = XOR(prev, current->npx);
+                prev = current;
+                current = next;
             }
+        }
 
-            XORListIterator operator--(int)
+        // Stable merge of two sorted chains by relinking; ties keep the nodes of `into` first.
+        // Whether it returns or `comp` throws, `into` ends up owning every node of both chains.
+        template <class Compare>
+        void merge_chains(Chain &into, Chain other, Compare &comp)
+        {
+            if (other.head == nullptr)
             {
-                XORListIterator temp = *this;
-                --(*this);
-                return temp;
+                return;
+            }
+            if (into.head == nullptr || !comp(other.head->data, into.tail->data))
+            {
+                append_chain(into, other);
+                return;
             }
 
-            XORListIterator operator+(difference_type n) const
+            Node *a = into.head, *a_prev = nullptr;
+            Node *b = other.head, *b_prev = nullptr;
+            Node *head = nullptr, *tail = nullptr, *tail_prev = nullptr;
+
+            // Links the unconsumed rest of a chain (starting at `rest`, previously preceded by `rest_prev`) after `tail`.
+            auto attach = [&](Node *rest, Node *rest_prev, Node *rest_tail)
             {
-                XORListIterator temp = *this;
-                for (difference_type i = 0; i < n; ++i)
+                if (rest == nullptr)
                 {
-                    if (temp.current_ == nullptr)
-                        break;
-                    ++temp;
+                    return;
                 }
-                return temp;
-            }
+                rest->npx = XOR(XOR(rest->npx, rest_prev), tail);
+                if (tail != nullptr)
+                {
+                    tail->npx = XOR(tail_prev, rest);
+                }
+                else
+                {
+                    head = rest;
+                }
+                tail = rest_tail;
+                tail_prev = XOR(rest_tail->npx, nullptr);
+            };
 
-            XORListIterator operator-(difference_type n) const
+            try
             {
-                XORListIterator temp = *this;
-                for (difference_type i = 0; i < n; ++i)
+                while (a != nullptr && b != nullptr)
                 {
-                    if (temp.prev_ == nullptr && temp.current_ == list_->m_head_)
-                        break;
-                    --temp;
+                    Node *taken;
+                    if (comp(b->data, a->data))
+                    {
+                        taken = b;
+                        b = XOR(b_prev, b->npx);
+                        b_prev = taken;
+                    }
+                    else
+                    {
+                        taken = a;
+                        a = XOR(a_prev, a->npx);
+                        a_prev = taken;
+                    }
+
+                    if (tail != nullptr)
+                    {
+                        tail->npx = XOR(tail_prev, taken);
+                    }
+                    else
+                    {
+                        head = taken;
+                    }
+                    tail_prev = tail;
+                    tail = taken;
                 }
-                return temp;
+            }
+            catch (...)
+            {
+                attach(a, a_prev, into.tail);
+                attach(b, b_prev, other.tail);
+                into = Chain{head, tail};
+                throw;
             }
 
-            difference_type operator-(const XORListIterator &other) const
+            attach(a, a_prev, into.tail);
+            attach(b, b_prev, other.tail);
+            into = Chain{head, tail};
+        }
+
+        // Body of sort(): cuts natural runs off `input` and merges them through the bucket counter into `carry`.
+        // Every node is owned by exactly one of `input`, `carry` or the buckets at any point `comp` may throw.
+        template <class Compare>
+        void sort_runs(Chain *buckets, size_t &levels, Chain &carry, Chain &input, Compare &comp)
+        {
+            while (input.head != nullptr)
             {
-                if (list_ != other.list_)
-                    return -1;
+                Node *first = input.head;
+                Node *prev = nullptr;
+                Node *current = first;
+                Node *next = XOR(prev, current->npx);
+                bool descending = next != nullptr && comp(next->data, current->data);
 
-                difference_type count = 0;
-                XORListIterator it = *this;
-                if (it < other)
+                while (next != nullptr && (descending ? comp(next->data, current->data) : !comp(next->data, current->data)))
                 {
-                    while (it != other)
-                    {
-                        ++it;
-                        ++count;
-                    }
+                    prev = current;
+                    current = next;
+                    next = XOR(prev, current->npx);
+                }
+
+                // Cut the run off the front of the input.
+                if (next != nullptr)
+                {
+                    current->npx = XOR(current->npx, next);
+                    next->npx = XOR(next->npx, current);
+                }
+                else
+                {
+                    input.tail = nullptr;
+                }
+                input.head = next;
+                carry = descending ? Chain{current, first} : Chain{first, current};
+
+                size_t level = 0;
+                for (; level < levels && buckets[level].head != nullptr; ++level)
+                {
+                    Chain later = carry;
+                    carry = Chain{nullptr, nullptr};
+                    merge_chains(buckets[level], later, comp);
+                    carry = buckets[level];
+                    buckets[level] = Chain{nullptr, nullptr};
+                }
+                buckets[level] = carry;
+                carry = Chain{nullptr, nullptr};
+                if (level == levels)
+                {
+                    ++levels;
+                }
+            }
+
+            for (size_t level = 0; level < levels; ++level)
+            {
+                Chain later = carry;
+                carry = Chain{nullptr, nullptr};
+                merge_chains(buckets[level], later, comp);
+                carry = buckets[level];
+                buckets[level] = Chain{nullptr, nullptr};
+            }
+        }
+
+    public:
+        explicit XORList(const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator) {}
+
+        XORList(size_t count, const T &value, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        {
+            link_built_chain(nullptr, nullptr, build_chain_n(count, value), count);
+        }
+
+        explicit XORList(size_t count, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        {
+            link_built_chain(nullptr, nullptr, build_chain_n(count), count);
+        }
+
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        XORList(InputIt first, InputIt last, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        {
+            append_range(first, last);
+        }
+
+        XORList(const XORList &other) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(std::allocator_traits<NodeAllocator>::select_on_container_copy_construction(other.alloc_))
+        {
+            if (other.m_index_ != nullptr)
+            {
+                enable_index(other.m_index_->stride);
+            }
+
+            // The length is known, so the copy goes through one batched build without measuring the source first.
+            const Node *prev = nullptr;
+            const Node *current = other.m_head_;
+            auto copy_next = [&](Node *node)
+            {
+                std::allocator_traits<NodeAllocator>::construct(alloc_, node, current->data);
+                const Node *next = XOR(prev, current->npx);
+                prev = current;
+                current = next;
+            };
+            link_built_chain(nullptr, nullptr, build_counted_chain(other.m_size_, copy_next), other.m_size_);
+            refresh_index();
+        }
+
+        XORList(XORList &&other) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(other.m_head_), m_tail_(other.m_tail_), m_size_(other.m_size_), alloc_(std::move(other.alloc_)),
+              m_index_(std::move(other.m_index_))
+        {
+            other.m_head_ = other.m_tail_ = nullptr;
+            other.m_size_ = 0;
+            other.note_reshape();
+        }
+
+        XORList(std::initializer_list<T> init, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_head_(nullptr), m_tail_(nullptr), m_size_(0), alloc_(allocator)
+        {
+            append_range(init.begin(), init.end());
+        }
+
+        bool operator==(const XORList &other) const noexcept
+        {
+            if (m_size_ != other.m_size_)
+            {
+                return false;
+            }
+
+            const Node *current = m_head_;
+            const Node *prev = nullptr;
+            const Node *next;
+
+            const Node *other_current = other.m_head_;
+            const Node *other_prev = nullptr;
+            const Node *other_next;
+
+            while (current != nullptr && other_current != nullptr)
+            {
+                if (current->data != other_current->data)
+                {
+                    return false;
+                }
+
+                next = XOR(prev, current->npx);
+                other_next = XOR(other_prev, other_current->npx);
+
+                prev = current;
+                current = next;
+
+                other_prev = other_current;
+                other_current = other_next;
+            }
+
+            return current == nullptr && other_current == nullptr;
+        }
+
+        bool operator!=(const XORList &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        ~XORList()
+        {
+            clear();
+            delete tracking();
+        }
+
+        XORList &operator=(const XORList &other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (this != &other)
+            {
+                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_copy_assignment::value)
+                {
+                    if (alloc_ != other.alloc_)
+                    {
+                        // Nodes from the old allocator cannot be kept once it is replaced.
+                        clear();
+                    }
+                    alloc_ = other.alloc_;
+                }
+                assign_range(other.cbegin(), other.cend());
+            }
+            return *this;
+        }
+
+        XORList &operator=(XORList &&other) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (this != &other)
+            {
+                clear();
+                if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_move_assignment::value)
+                {
+                    alloc_ = std::move(other.alloc_);
+                }
+                else if (alloc_ != other.alloc_)
+                {
+                    for (Node *current = other.m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+                    {
+                        next = XOR(prev, current->npx);
+                        push_back(std::move(current->data));
+                    }
+                    other.clear();
+                    return *this;
+                }
+                m_head_ = other.m_head_;
+                m_tail_ = other.m_tail_;
+                m_size_ = other.m_size_;
+                if (other.m_index_ != nullptr)
+                {
+                    m_index_ = std::move(other.m_index_);
+                }
+
+                other.m_head_ = other.m_tail_ = nullptr;
+                other.m_size_ = 0;
+                other.note_reshape();
+            }
+            return *this;
+        }
+
+        XORList &operator=(std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            assign_range(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+        void assign(size_t count, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            clear();
+            link_built_chain(nullptr, nullptr, build_chain_n(count, value), count);
+        }
+
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        void assign(InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            assign_range(first, last);
+        }
+
+        void assign(std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            assign_range(ilist.begin(), ilist.end());
+        }
+
+        auto get_allocator() const noexcept
+        {
+            return Allocator(alloc_);
+        }
+
+        T &front() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            return m_head_->data;
+        }
+
+        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            return m_head_->data;
+        }
+
+        T &back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            return m_tail_->data;
+        }
+
+        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            return m_tail_->data;
+        }
+
+        T &at(size_t position) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (position >= m_size_)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::out_of_range("Position out of range");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            refresh_index();
+            return seek(position).second->data;
+        }
+
+        const T &at(size_t position) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (position >= m_size_)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::out_of_range("Position out of range");
+                }
+                else
+                {
+                    return m_tail_->data; // undefined behavior
+                }
+            }
+            return seek(position).second->data;
+        }
+
+        template <bool IsConst>
+        class XORListIterator
+        {
+        private:
+            using NodeType = std::conditional_t<IsConst, const Node, Node>;
+            using XORListType = std::conditional_t<IsConst, const XORList, XORList>;
+
+            NodeType *prev_;
+            NodeType *current_;
+            XORListType *list_;
+
+            friend class XORList<T, canThrow, Allocator>;
+
+            template <bool>
+            friend class XORListIterator;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T *, T *>;
+            using reference = std::conditional_t<IsConst, const T &, T &>;
+
+            XORListIterator(NodeType *prev, NodeType *current, XORListType *list)
+                : prev_(prev), current_(current), list_(list) {}
+
+            template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+            XORListIterator(const XORListIterator<WasConst> &other)
+                : prev_(other.prev_), current_(other.current_), list_(other.list_) {}
+
+            reference operator*() const { return current_->data; }
+            pointer operator->() const { return &(current_->data); }
+
+            XORListIterator &operator++()
+            {
+                if (current_ == nullptr)
+                {
+                    return *this; // Already at end, do nothing
+                }
+
+                NodeType *next = list_->XOR(prev_, current_->npx);
+                prev_ = current_;
+                current_ = next;
+                return *this;
+            }
+
+            XORListIterator operator++(int)
+            {
+                XORListIterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            XORListIterator &operator--()
+            {
+                if (prev_ == nullptr)
+                {
+                    return *this; // Already at begin, do nothing
+                }
+
+                NodeType *next = list_->XOR(prev_->npx, current_);
+                current_ = prev_;
+                prev_ = next;
+                return *this;
+            }
+
+            XORListIterator operator--(int)
+            {
+                XORListIterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            XORListIterator operator+(difference_type n) const
+            {
+                if constexpr (!IsConst)
+                {
+                    list_->refresh_index();
+                }
+                size_t position;
+                if (n > 0 && list_->locate(prev_, current_, position))
+                {
+                    auto target = list_->seek(std::min(position + static_cast<size_t>(n), list_->m_size_));
+                    return XORListIterator(target.first, target.second, list_);
+                }
+
+                XORListIterator temp = *this;
+                for (difference_type i = 0; i < n; ++i)
+                {
+                    if (temp.current_ == nullptr)
+                        break;
+                    ++temp;
+                }
+                return temp;
+            }
+
+            XORListIterator operator-(difference_type n) const
+            {
+                if constexpr (!IsConst)
+                {
+                    list_->refresh_index();
+                }
+                size_t position;
+                if (n > 0 && list_->locate(prev_, current_, position))
+                {
+                    auto target = list_->seek(position - std::min(position, static_cast<size_t>(n)));
+                    return XORListIterator(target.first, target.second, list_);
+                }
+
+                XORListIterator temp = *this;
+                for (difference_type i = 0; i < n; ++i)
+                {
+                    if (temp.prev_ == nullptr && temp.current_ == list_->m_head_)
+                        break;
+                    --temp;
+                }
+                return temp;
+            }
+
+            difference_type operator-(const XORListIterator &other) const
+            {
+                if (list_ != other.list_)
+                    return -1;
+
+                if constexpr (!IsConst)
+                {
+                    list_->refresh_index();
+                }
+                size_t position, other_position;
+                if (list_->locate(prev_, current_, position) && list_->locate(other.prev_, other.current_, other_position))
+                {
+                    return static_cast<difference_type>(position) - static_cast<difference_type>(other_position);
+                }
+
+                // Without an index, step outward from *this in both directions until one side meets `other`, so the
+                // cost is twice the distance and the sign matches the indexed path.
+                XORListIterator ahead = *this;
+                XORListIterator behind = *this;
+                for (difference_type steps = 0;; ++steps)
+                {
+                    if (ahead == other)
+                    {
+                        return -steps;
+                    }
+                    if (behind == other)
+                    {
+                        return steps;
+                    }
+                    bool ahead_stuck = ahead.current_ == nullptr;
+                    bool behind_stuck = behind.prev_ == nullptr;
+                    if (ahead_stuck && behind_stuck)
+                    {
+                        return 0; // `other` is not reachable from *this; it refers to a different sequence
+                    }
+                    ++ahead;
+                    --behind;
+                }
+            }
+
+            // Orders by position in the list, which costs what operator-(const XORListIterator &) does.
+            bool operator<(const XORListIterator &other) const
+            {
+                if (list_ != other.list_)
+                    return false;
+
+                return *this - other < 0;
+            }
+
+            bool operator==(const XORListIterator &other) const { return current_ == other.current_; }
+            bool operator!=(const XORListIterator &other) const { return current_ != other.current_; }
+        };
+
+        // Aliases for iterator and const_iterator
+        using iterator = XORListIterator<false>;
+        using const_iterator = XORListIterator<true>;
+
+        // Remembers the last position it was moved to, so a run of nearby positional lookups walks only the gap
+        // between them, or starts from the nearer end or checkpoint when that is shorter. It stays valid across
+        // pushes and emplaces at either end; after any other change to the list it re-seeks on its next move.
+        template <bool IsConst>
+        class XORListCursor
+        {
+        private:
+            using NodeType = std::conditional_t<IsConst, const Node, Node>;
+            using XORListType = std::conditional_t<IsConst, const XORList, XORList>;
+            using IteratorType = XORListIterator<IsConst>;
+
+            XORListType *list_;
+            NodeType *prev_;
+            NodeType *current_;
+            size_t position_;
+            size_t version_;
+            size_t front_shift_;
+
+            friend class XORList<T, canThrow, Allocator>;
+
+            explicit XORListCursor(XORListType *list)
+                : list_(list), prev_(nullptr), current_(nullptr), position_(0), version_(0), front_shift_(0)
+            {
+                list->start_tracking();
+            }
+
+        public:
+            using reference = std::conditional_t<IsConst, const T &, T &>;
+
+            // Moves to `position` (at most size()) and returns an iterator there.
+            IteratorType seek(size_t position)
+            {
+                if constexpr (!IsConst)
+                {
+                    list_->refresh_index();
+                }
+                const XORList &list = *list_;
+                if (position > list.m_size_)
+                {
+                    if constexpr (canThrow == CanThrow::Throw)
+                    {
+                        throw std::out_of_range("Position out of range");
+                    }
+                    else
+                    {
+                        position = list.m_size_;
+                    }
+                }
+
+                // Pushes at the front shift every remembered position; a cursor at either end has a null neighbour
+                // that such a push replaces, so it is re-seeked too.
+                const Tracking *counters = list.tracking();
+                bool stale = counters == nullptr || current_ == nullptr;
+                if (counters != nullptr)
+                {
+                    position_ += counters->front_shift - front_shift_;
+                    front_shift_ = counters->front_shift;
+                    stale = stale || version_ != counters->version || (prev_ == nullptr && position_ != 0);
+                }
+
+                size_t gap = position > position_ ? position - position_ : position_ - position;
+                size_t from_end = std::min(position, list.m_size_ - position);
+                if (list.m_index_ != nullptr)
+                {
+                    from_end = std::min(from_end, list.m_index_->stride / 2);
+                }
+
+                if (stale || gap > from_end)
+                {
+                    auto target = list.seek(position);
+                    prev_ = target.first;
+                    current_ = target.second;
+                    version_ = counters != nullptr ? counters->version : 0;
+                }
+                else if (position > position_)
+                {
+                    for (; gap > 0; --gap)
+                    {
+                        NodeType *next = list.XOR(prev_, current_->npx);
+                        prev_ = current_;
+                        current_ = next;
+                    }
+                }
+                else
+                {
+                    for (; gap > 0; --gap)
+                    {
+                        NodeType *before = list.XOR(prev_->npx, current_);
+                        current_ = prev_;
+                        prev_ = before;
+                    }
+                }
+
+                position_ = position;
+                return IteratorType(prev_, current_, list_);
+            }
+
+            // Moves to `position` and returns the element there. As with XORList::at, `position` must be less than
+            // size(): under CanThrow::Throw a larger one throws std::out_of_range, under NoThrow the result is
+            // undefined (the cursor does not move and the tail's element is returned, as at() does).
+            reference at(size_t position)
+            {
+                if (position >= list_->m_size_)
+                {
+                    if constexpr (canThrow == CanThrow::Throw)
+                    {
+                        throw std::out_of_range("Position out of range");
+                    }
+                    else
+                    {
+                        return list_->m_tail_->data; // undefined behavior
+                    }
+                }
+                return *seek(position);
+            }
+
+            size_t position() const noexcept
+            {
+                return position_;
+            }
+        };
+
+        // Relocates the nodes of a list into list order a bounded number at a time, so compaction can be spread
+        // over idle moments. Each step invalidates iterators and references into the relocated run. Any other
+        // reshaping of the list between steps (anything but pushes at the back) makes the next step start over
+        // from the head, as does every step if the list ran out of memory for its change counters.
+        class XORListCompactor
+        {
+        private:
+            XORList *list_;
+            Node *prev_;
+            Node *current_;
+            size_t version_;
+            size_t front_shift_;
+            bool done_;
+
+            friend class XORList<T, canThrow, Allocator>;
+
+            explicit XORListCompactor(XORList *list)
+                : list_(list), prev_(nullptr), current_(list->m_head_), version_(0), front_shift_(0), done_(false)
+            {
+                if (const Tracking *counters = list->start_tracking())
+                {
+                    version_ = counters->version;
+                    front_shift_ = counters->front_shift;
+                }
+            }
+
+            bool in_sync(const Tracking *counters) const noexcept
+            {
+                return counters != nullptr && version_ == counters->version && front_shift_ == counters->front_shift;
+            }
+
+        public:
+            // Relocates up to `budget` more nodes. Returns true once the whole list has been relocated.
+            bool step(size_t budget) noexcept(canThrow == CanThrow::NoThrow)
+            {
+                XORList &list = *list_;
+                const Tracking *counters = list.tracking();
+                if (!in_sync(counters))
+                {
+                    prev_ = nullptr;
+                    current_ = list.m_head_;
+                    done_ = false;
+                }
+                if (!done_)
+                {
+                    auto next = list.relocate_run(prev_, current_, budget);
+                    prev_ = next.first;
+                    current_ = next.second;
+                    done_ = current_ == nullptr;
+                }
+                if (counters != nullptr)
+                {
+                    version_ = counters->version;
+                    front_shift_ = counters->front_shift;
+                }
+                return done_;
+            }
+
+            bool done() const noexcept
+            {
+                return done_ && in_sync(list_->tracking());
+            }
+        };
+
+        // Owns one node taken out of a list by extract(), so an element can move between lists of the same type
+        // without being freed and reallocated. A handle that still holds a node destroys it on destruction.
+        class XORListNodeHandle
+        {
+        private:
+            Node *node_;
+            std::optional<NodeAllocator> alloc_;
+
+            friend class XORList<T, canThrow, Allocator>;
+
+            XORListNodeHandle(Node *node, const NodeAllocator &alloc) : node_(node), alloc_(alloc) {}
+
+            Node *release() noexcept
+            {
+                Node *node = node_;
+                node_ = nullptr;
+                alloc_.reset();
+                return node;
+            }
+
+            void reset() noexcept
+            {
+                if (node_ != nullptr)
+                {
+                    std::allocator_traits<NodeAllocator>::destroy(*alloc_, node_);
+                    std::allocator_traits<NodeAllocator>::deallocate(*alloc_, node_, 1);
+                    release();
+                }
+            }
+
+        public:
+            using value_type = T;
+            using allocator_type = Allocator;
+
+            constexpr XORListNodeHandle() noexcept : node_(nullptr), alloc_() {}
+
+            XORListNodeHandle(XORListNodeHandle &&other) noexcept : node_(other.node_), alloc_(std::move(other.alloc_))
+            {
+                other.release();
+            }
+
+            XORListNodeHandle &operator=(XORListNodeHandle &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    reset();
+                    node_ = other.node_;
+                    alloc_ = std::move(other.alloc_);
+                    other.release();
+                }
+                return *this;
+            }
+
+            XORListNodeHandle(const XORListNodeHandle &) = delete;
+            XORListNodeHandle &operator=(const XORListNodeHandle &) = delete;
+
+            ~XORListNodeHandle()
+            {
+                reset();
+            }
+
+            bool empty() const noexcept
+            {
+                return node_ == nullptr;
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return node_ != nullptr;
+            }
+
+            T &value() const noexcept
+            {
+                return node_->data;
+            }
+
+            allocator_type get_allocator() const
+            {
+                return allocator_type(*alloc_);
+            }
+        };
+
+        using node_type = XORListNodeHandle;
+
+        using cursor = XORListCursor<false>;
+        using const_cursor = XORListCursor<true>;
+
+        cursor make_cursor() noexcept
+        {
+            return cursor(this);
+        }
+
+        using compactor = XORListCompactor;
+
+        // Returns a compactor for relocating the list in bounded steps; see XORListCompactor.
+        compactor make_compactor() noexcept
+        {
+            return compactor(this);
+        }
+
+        // Copies the elements, in list order, into a contiguous read-only FrozenXORList with random access.
+        FrozenXORList<T, canThrow, Allocator> freeze() const & noexcept(canThrow == CanThrow::NoThrow)
+        {
+            std::vector<T, Allocator> elements(get_allocator());
+            elements.reserve(m_size_);
+            for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+            {
+                next = XOR(prev, current->npx);
+                elements.push_back(current->data);
+            }
+            return FrozenXORList<T, canThrow, Allocator>(std::move(elements));
+        }
+
+        // Moves the elements into a FrozenXORList, freeing each node as soon as its element has moved out.
+        FrozenXORList<T, canThrow, Allocator> freeze() && noexcept(canThrow == CanThrow::NoThrow)
+        {
+            std::vector<T, Allocator> elements(get_allocator());
+            elements.reserve(m_size_);
+            while (m_head_ != nullptr)
+            {
+                elements.push_back(std::move_if_noexcept(m_head_->data));
+                pop_front();
+            }
+            return FrozenXORList<T, canThrow, Allocator>(std::move(elements));
+        }
+
+        // Moves every element into freshly allocated nodes laid out in list order, so traversal walks memory
+        // forwards again after a long run of scattered inserts and erases. With an allocator that supports
+        // batched allocation (XORListPool) the new nodes form one contiguous block. Invalidates iterators and
+        // references. If an element's copy throws, the list is left as it was.
+        void compact() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            relocate_run(nullptr, m_head_, m_size_);
+        }
+
+        const_cursor make_cursor() const noexcept
+        {
+            return const_cursor(this);
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(nullptr, m_head_, this);
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(nullptr, m_head_, this);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(m_tail_, nullptr, this);
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(m_tail_, nullptr, this);
+        }
+
+        iterator rbegin() noexcept
+        {
+            return iterator(nullptr, m_tail_, this);
+        }
+
+        const_iterator crbegin() const noexcept
+        {
+            return const_iterator(nullptr, m_tail_, this);
+        }
+
+        iterator rend() noexcept
+        {
+            return iterator(m_head_, nullptr, this);
+        }
+
+        const_iterator crend() const noexcept
+        {
+            return const_iterator(m_head_, nullptr, this);
+        }
+
+        // Iterator to the element at `position`; `position == size()` gives end().
+        iterator iterator_at(size_t position) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (position > m_size_)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::out_of_range("Position out of range");
+                }
+                else
+                {
+                    return end(); // No operation on out of range position
+                }
+            }
+            refresh_index();
+            auto target = seek(position);
+            return iterator(target.first, target.second, this);
+        }
+
+        const_iterator iterator_at(size_t position) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (position > m_size_)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::out_of_range("Position out of range");
+                }
+                else
+                {
+                    return cend(); // No operation on out of range position
+                }
+            }
+            auto target = seek(position);
+            return const_iterator(target.first, target.second, this);
+        }
+
+        bool empty() const noexcept
+        {
+            return m_size_ == 0;
+        }
+
+        size_t size() const noexcept
+        {
+            return m_size_;
+        }
+
+        size_t max_size() const noexcept
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+
+        // Keeps a checkpoint every `stride` nodes so at(), iterator_at(), iterator +/-, iterator distance and
+        // positional splice cost O(n / stride + stride) instead of a walk from the head. Costs about two pointers
+        // per checkpoint plus a hash slot; see PositionIndex for when it is rebuilt.
+        //
+        // The index is built here. Changes that leave it stale are caught up by the next non-const positional
+        // query (at(), iterator_at(), arithmetic on a mutable iterator or cursor, positional splice) or by
+        // rebuild_index(); const members never write to it, so they are safe for concurrent readers and walk from
+        // the nearer end while it is stale.
+        void enable_index(size_t stride = 64) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (stride == 0)
+            {
+                stride = 1;
+            }
+            if (m_index_ == nullptr)
+            {
+                m_index_ = std::make_unique<PositionIndex>();
+            }
+            m_index_->stride = stride;
+            m_index_->stale = true;
+            refresh_index();
+        }
+
+        // Brings a stale index up to date, so const queries can use it again.
+        void rebuild_index() noexcept
+        {
+            refresh_index();
+        }
+
+        void disable_index() noexcept
+        {
+            m_index_.reset();
+        }
+
+        // Trivially destructible elements in an allocator that can take all its storage back at once (such as a
+        // sole XORListPool) are dropped without walking the list.
+        void clear() noexcept
+        {
+            if (empty())
+            {
+                return;
+            }
+
+            if constexpr (std::is_trivially_destructible_v<T> && detail::has_release_all<NodeAllocator>::value)
+            {
+                if (alloc_.release_all())
+                {
+                    m_head_ = m_tail_ = nullptr;
+                    m_size_ = 0;
+                    note_reshape();
+                    return;
+                }
+            }
+
+            Node *current = m_head_;
+            Node *prev = nullptr;
+            Node *next;
+
+            while (current != nullptr)
+            {
+                next = XOR(prev, current->npx);
+                deallocate_node(current);
+                prev = current;
+                current = next;
+            }
+
+            m_head_ = m_tail_ = nullptr;
+            m_size_ = 0;
+            note_reshape();
+        }
+
+        iterator insert(const_iterator pos, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        // Returns an iterator to the first inserted element, or `pos` when `count` is zero.
+        iterator insert(const_iterator pos, size_t count, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            Chain chain = build_chain_n(count, value);
+            if (chain.head == nullptr)
+            {
+                return iterator(prev, current, this);
+            }
+
+            link_built_chain(prev, current, chain, count);
+            return iterator(prev, chain.head, this);
+        }
+
+        // Builds the new elements as a detached chain and links it in with a single boundary fixup. Returns an
+        // iterator to the first inserted element, or `pos` when the range is empty.
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        iterator insert(const_iterator pos, InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            size_t count = 0;
+            Chain chain = build_chain(first, last, count);
+            if (chain.head == nullptr)
+            {
+                return iterator(prev, current, this);
+            }
+
+            link_built_chain(prev, current, chain, count);
+            return iterator(prev, chain.head, this);
+        }
+
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        void append_range(InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            size_t count = 0;
+            Chain chain = build_chain(first, last, count);
+            link_built_chain(m_tail_, nullptr, chain, count);
+        }
+
+        template <class Range>
+        void append_range(Range &&range) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            append_range(std::begin(range), std::end(range));
+        }
+
+        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
+        void prepend_range(InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            size_t count = 0;
+            Chain chain = build_chain(first, last, count);
+            link_built_chain(nullptr, m_head_, chain, count);
+        }
+
+        template <class Range>
+        void prepend_range(Range &&range) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            prepend_range(std::begin(range), std::end(range));
+        }
+
+        // Writes a small header and every element to `out`. With the default RawCodec the element bytes are
+        // gathered and written in 64 KiB blocks; any other codec encodes one element at a time. Returns whether
+        // the stream accepted everything.
+        template <class Codec = RawCodec<T>>
+        bool write_to(std::ostream &out, const Codec &codec = Codec()) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            constexpr bool raw = std::is_same_v<Codec, RawCodec<T>>;
+            const std::uint32_t element_size = raw ? static_cast<std::uint32_t>(sizeof(T)) : 0;
+            const std::uint64_t count = m_size_;
+            out.write(detail::kStreamMagic, sizeof(detail::kStreamMagic));
+            out.write(reinterpret_cast<const char *>(&element_size), sizeof(element_size));
+            out.write(reinterpret_cast<const char *>(&count), sizeof(count));
+
+            if constexpr (raw)
+            {
+                constexpr size_t block = std::max<size_t>(1, detail::kStreamBlockBytes / sizeof(T));
+                std::vector<char> buffer(block * sizeof(T));
+                size_t filled = 0;
+                for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+                {
+                    next = XOR(prev, current->npx);
+                    std::memcpy(buffer.data() + filled * sizeof(T), &current->data, sizeof(T));
+                    if (++filled == block)
+                    {
+                        out.write(buffer.data(), static_cast<std::streamsize>(filled * sizeof(T)));
+                        filled = 0;
+                    }
+                }
+                out.write(buffer.data(), static_cast<std::streamsize>(filled * sizeof(T)));
+            }
+            else
+            {
+                for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr && out; prev = current, current = next)
+                {
+                    next = XOR(prev, current->npx);
+                    codec.encode(out, current->data);
+                }
+            }
+
+            if (!out)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::ios_base::failure("XORList: writing the stream failed");
+                }
+                return false;
+            }
+            return true;
+        }
+
+        // Appends the serialized list to `buffer`.
+        template <class Codec = RawCodec<T>>
+        bool write_to(std::vector<unsigned char> &buffer, const Codec &codec = Codec()) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (std::is_same_v<Codec, RawCodec<T>>)
+            {
+                // The final size is known, so the elements are copied straight into place.
+                const std::uint32_t element_size = static_cast<std::uint32_t>(sizeof(T));
+                const std::uint64_t count = m_size_;
+                size_t offset = buffer.size();
+                buffer.resize(offset + sizeof(detail::kStreamMagic) + sizeof(element_size) + sizeof(count) + m_size_ * sizeof(T));
+                unsigned char *out = buffer.data() + offset;
+                std::memcpy(out, detail::kStreamMagic, sizeof(detail::kStreamMagic));
+                out += sizeof(detail::kStreamMagic);
+                std::memcpy(out, &element_size, sizeof(element_size));
+                out += sizeof(element_size);
+                std::memcpy(out, &count, sizeof(count));
+                out += sizeof(count);
+                for (const Node *current = m_head_, *prev = nullptr, *next; current != nullptr; prev = current, current = next)
+                {
+                    next = XOR(prev, current->npx);
+                    std::memcpy(out, &current->data, sizeof(T));
+                    out += sizeof(T);
+                }
+                return true;
+            }
+
+            detail::VectorWriteBuffer sink(buffer);
+            std::ostream out(&sink);
+            return write_to(out, codec);
+        }
+
+        // Replaces the contents with a list written by write_to() with the same codec. The elements are built
+        // into a detached chain first (one allocation per block where the allocator allows it), so on a malformed
+        // or truncated stream, or when memory runs out, the list is left unchanged and false is returned, or
+        // std::ios_base::failure / std::bad_alloc thrown.
+        template <class Codec = RawCodec<T>>
+        bool read_from(std::istream &in, const Codec &codec = Codec()) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            constexpr bool raw = std::is_same_v<Codec, RawCodec<T>>;
+            char magic[sizeof(detail::kStreamMagic)] = {};
+            std::uint32_t element_size = 0;
+            std::uint64_t count = 0;
+            in.read(magic, sizeof(magic));
+            in.read(reinterpret_cast<char *>(&element_size), sizeof(element_size));
+            in.read(reinterpret_cast<char *>(&count), sizeof(count));
+
+            try
+            {
+                if (!in || !std::equal(std::begin(magic), std::end(magic), detail::kStreamMagic) ||
+                    element_size != (raw ? sizeof(T) : 0))
+                {
+                    throw std::ios_base::failure("XORList: stream does not hold a list of this type");
+                }
+
+                if (count > max_size())
+                {
+                    throw std::ios_base::failure("XORList: stream holds more elements than fit in memory");
+                }
+
+                // Elements are built one block at a time, and a raw block is only allocated once its bytes have been
+                // read, so a header claiming more elements than the stream holds ends in a short read rather than in
+                // an allocation sized by the claim.
+                constexpr size_t block = std::max<size_t>(1, detail::kStreamBlockBytes / sizeof(T));
+                std::allocator<T> block_allocator;
+                T *buffer = nullptr; // raw storage for one block; T is trivially copyable, so its bytes are the object
+                Chain chain = {nullptr, nullptr};
+                try
+                {
+                    if constexpr (raw)
+                    {
+                        buffer = block_allocator.allocate(block);
+                    }
+                    for (std::uint64_t remaining = count; remaining != 0;)
+                    {
+                        size_t batch = static_cast<size_t>(std::min<std::uint64_t>(block, remaining));
+                        if constexpr (raw)
+                        {
+                            in.read(reinterpret_cast<char *>(buffer), static_cast<std::streamsize>(batch * sizeof(T)));
+                            if (static_cast<size_t>(in.gcount()) != batch * sizeof(T))
+                            {
+                                throw std::ios_base::failure("XORList: stream ended early");
+                            }
+                            size_t next = 0;
+                            auto construct_next = [&](Node *node)
+                            {
+                                std::allocator_traits<NodeAllocator>::construct(alloc_, node, *std::launder(buffer + next));
+                                ++next;
+                            };
+                            append_chain(chain, build_counted_chain(batch, construct_next));
+                        }
+                        else
+                        {
+                            auto construct_next = [&](Node *node)
+                            {
+                                T value = codec.decode(in);
+                                if (!in)
+                                {
+                                    throw std::ios_base::failure("XORList: stream ended early");
+                                }
+                                std::allocator_traits<NodeAllocator>::construct(alloc_, node, std::move(value));
+                            };
+                            append_chain(chain, build_counted_chain(batch, construct_next));
+                        }
+                        remaining -= batch;
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_chain(chain);
+                    if (buffer != nullptr)
+                    {
+                        block_allocator.deallocate(buffer, block);
+                    }
+                    throw;
+                }
+                if (buffer != nullptr)
+                {
+                    block_allocator.deallocate(buffer, block);
+                }
+
+                clear();
+                link_built_chain(nullptr, nullptr, chain, static_cast<size_t>(count));
+                return true;
+            }
+            catch (const std::ios_base::failure &)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw;
+                }
+                return false;
+            }
+            catch (const std::bad_alloc &)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw;
+                }
+                return false;
+            }
+        }
+
+        // Reads a list written by write_to(std::vector<unsigned char> &) from `size` bytes at `data`. Returns the
+        // number of bytes consumed, so lists stored back to back can be read in turn, or 0 on failure.
+        template <class Codec = RawCodec<T>>
+        size_t read_from(const void *data, size_t size, const Codec &codec = Codec()) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            detail::MemoryReadBuffer source(data, size);
+            std::istream in(&source);
+            return read_from(in, codec) ? source.consumed() : 0;
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (pos == cbegin())
+            {
+                emplace_front(std::forward<Args>(args)...);
+                return begin();
+            }
+            if (pos == cend())
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return --end();
+            }
+
+            Node *newNode = allocate_node(std::forward<Args>(args)...);
+
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            Node *next = XOR(prev, current->npx);
+
+            newNode->npx = XOR(prev, current);
+            prev->npx = XOR(XOR(prev->npx, current), newNode);
+            current->npx = XOR(newNode, next);
+
+            ++m_size_;
+            note_reshape();
+            return iterator(prev, newNode, this);
+        }
+
+        iterator erase(const_iterator pos) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (pos == cend())
+            {
+                return end();
+            }
+
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            Node *next = XOR(prev, current->npx);
+
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(XOR(prev->npx, current), next);
+            }
+            else
+            {
+                m_head_ = next;
+            }
+
+            if (next != nullptr)
+            {
+                next->npx = XOR(prev, XOR(current, next->npx));
+            }
+            else
+            {
+                m_tail_ = prev;
+            }
+
+            deallocate_node(current);
+            --m_size_;
+            note_reshape();
+
+            return iterator(prev, next, this);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (first == last)
+            {
+                //  If [first, last) is an empty range, then last is returned.
+                return iterator(const_cast<Node *>(last.prev_), const_cast<Node *>(last.current_), this);
+            }
+
+            note_reshape();
+            Node *first_prev = const_cast<Node *>(first.prev_);
+            Node *last_current = const_cast<Node *>(last.current_);
+            Node *last_next = XOR(last_current->npx, const_cast<Node *>(last.prev_));
+            Node *current = const_cast<Node *>(first.current_);
+            Node *current_prev = first_prev;
+            Node *current_backup = current;
+
+            while (current != last_current)
+            {
+                Node *next = XOR(current_prev, current->npx);
+                current_prev = current;
+                deallocate_node(current);
+                current = next;
+                --m_size_;
+            }
+
+            if (first_prev != nullptr)
+            {
+                first_prev->npx = XOR(XOR(first_prev->npx, current_backup), last_current);
+            }
+            else
+            {
+                last_current->npx = XOR(first_prev, last_next);
+                m_head_ = last_current;
+            }
+
+            if (last_current != nullptr)
+            {
+                last_current->npx = XOR(first_prev, XOR(const_cast<Node *>(last.prev_), last_current->npx));
+            }
+            else
+            {
+                first_prev->npx = XOR(XOR(first_prev->npx, current_backup), last_current);
+                m_tail_ = first_prev;
+            }
+
+            return iterator(first_prev, last_current, this);
+        }
+
+        void push_back(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            link_back(allocate_node(value));
+        }
+
+        // Unlinks the element at `pos` in O(1) without freeing it; the handle is empty when `pos` is end().
+        node_type extract(const_iterator pos) noexcept
+        {
+            if (pos.current_ == nullptr)
+            {
+                return node_type();
+            }
+
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            Node *next = XOR(prev, current->npx);
+            unlink_range(prev, current, current, next);
+            --m_size_;
+            current->npx = nullptr;
+            return node_type(current, alloc_);
+        }
+
+        // Links the node owned by `node` in front of `pos`; nothing is allocated. The node must come from a list
+        // whose allocator compares equal to this one. Returns an iterator to it, or `pos` for an empty handle.
+        iterator insert(const_iterator pos, node_type &&node) noexcept
+        {
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            if (node.empty())
+            {
+                return iterator(prev, current, this);
+            }
+
+            // At either end the push paths keep the index and cursors current.
+            Node *inserted = node.release();
+            if (current == nullptr)
+            {
+                link_back(inserted);
+            }
+            else if (prev == nullptr)
+            {
+                link_front(inserted);
+            }
+            else
+            {
+                link_chain(prev, current, Chain{inserted, inserted});
+                ++m_size_;
+            }
+            return iterator(prev, inserted, this);
+        }
+
+        void push_back(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            link_back(allocate_node(std::move(value)));
+        }
+
+        template <class... Args>
+        T &emplace_back(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Node *newNode = allocate_node(std::forward<Args>(args)...);
+            link_back(newNode);
+            return newNode->data;
+        }
+
+        void pop_back() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
                 }
                 else
                 {
-                    while (it != other)
-                    {
-                        --it;
-                        ++count;
-                    }
+                    return; // No operation on empty list
                 }
-                return count;
             }
 
-            bool operator<(const XORListIterator &other) const
-            {
-                // lexigraphical comparison
-                if (list_ != other.list_)
-                    return false;
+            bump_version();
+            Node *temp = m_tail_;
+            Node *prev = XOR(nullptr, m_tail_->npx);
 
-                if (prev_ == nullptr && other.prev_ == nullptr)
-                    return current_ < other.current_;
-                if (prev_ == nullptr)
-                    return true;
-                if (other.prev_ == nullptr)
-                    return false;
-                return prev_ < other.prev_;
+            if (m_index_ != nullptr && !m_index_->stale && m_index_->checkpoints.back().node == temp)
+            {
+                m_index_->checkpoints.pop_back();
+                m_index_->slots.erase(temp);
             }
 
-            bool operator==(const XORListIterator &other) const { return current_ == other.current_; }
-            bool operator!=(const XORListIterator &other) const { return current_ != other.current_; }
-        };
-
-        // Aliases for iterator and const_iterator
-        using iterator = XORListIterator<false>;
-        using const_iterator = XORListIterator<true>;
+            if (prev != nullptr)
+            {
+                prev->npx = XOR(temp, prev->npx);
+            }
+            else
+            {
+                m_head_ = nullptr;
+            }
 
-        iterator begin() noexcept
-        {
-            return iterator(nullptr, m_head_, this);
+            m_tail_ = prev;
+            deallocate_node(temp);
+            --m_size_;
         }
 
-        const_iterator cbegin() const noexcept
+        void push_front(const T &value) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return const_iterator(nullptr, m_head_, this);
+            link_front(allocate_node(value));
         }
 
-        iterator end() noexcept
+        void push_front(T &&value) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return iterator(m_tail_, nullptr, this);
+            link_front(allocate_node(std::move(value)));
         }
 
-        const_iterator cend() const noexcept
+        template <class... Args>
+        T &emplace_front(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return const_iterator(m_tail_, nullptr, this);
+            Node *newNode = allocate_node(std::forward<Args>(args)...);
+            link_front(newNode);
+            return newNode->data;
         }
 
-        iterator rbegin() noexcept
+        void pop_front() noexcept(canThrow == CanThrow::NoThrow)
         {
-            return iterator(nullptr, m_tail_, this);
-        }
+            if (empty())
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
 
-        const_iterator crbegin() const noexcept
-        {
-            return const_iterator(nullptr, m_tail_, this);
+            note_reshape();
+            if (Tracking *counters = tracking())
+            {
+                --counters->front_shift;
+            }
+            Node *temp = m_head_;
+            Node *next = XOR(nullptr, m_head_->npx);
+
+            if (next != nullptr)
+            {
+                next->npx = XOR(temp, next->npx);
+            }
+            else
+            {
+                m_tail_ = nullptr;
+            }
+
+            m_head_ = next;
+            deallocate_node(temp);
+            --m_size_;
         }
 
-        iterator rend() noexcept
+        void resize(size_t count) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return iterator(m_head_, nullptr, this);
+            if (count < m_size_)
+            {
+                truncate(count);
+            }
+            else if (count > m_size_)
+            {
+                size_t grow = count - m_size_;
+                link_built_chain(m_tail_, nullptr, build_chain_n(grow), grow);
+            }
         }
 
-        const_iterator crend() const noexcept
+        // Growing builds the new elements as one detached chain and links it once; shrinking finds the cut from
+        // the nearer end and frees the cut-off chain in one sweep.
+        void resize(size_t count, const T &value) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return const_iterator(m_head_, nullptr, this);
+            if (count < m_size_)
+            {
+                truncate(count);
+            }
+            else if (count > m_size_)
+            {
+                size_t grow = count - m_size_;
+                link_built_chain(m_tail_, nullptr, build_chain_n(grow, value), grow);
+            }
         }
 
-        bool empty() const noexcept
+        void swap(XORList &other) noexcept
         {
-            return m_size_ == 0;
+            using std::swap;
+
+            if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_swap::value)
+            {
+                swap(alloc_, other.alloc_);
+            }
+
+            swap(m_head_, other.m_head_);
+            swap(m_tail_, other.m_tail_);
+            swap(m_size_, other.m_size_);
+            swap(m_index_, other.m_index_);
+            bump_version();
+            other.bump_version();
         }
 
-        size_t size() const noexcept
+        void merge(XORList &other) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return m_size_;
+            merge(other, std::less<>());
         }
 
-        size_t max_size() const noexcept
+        void merge(XORList &&other) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return std::numeric_limits<size_t>::max();
+            merge(other, std::less<>());
         }
 
-        void clear() noexcept
+        // Merges the sorted `other` into this sorted list in O(n + m) by relinking nodes; nothing is allocated.
+        // The merge is stable and elements of this list come first among equals. Both lists must share an equal
+        // allocator, as with std::list::merge. If `comp` throws, every node ends up in this list in unspecified order.
+        template <class Compare>
+        void merge(XORList &other, Compare comp) noexcept(canThrow == CanThrow::NoThrow)
         {
-            if (empty())
+            if (&other == this || other.empty())
             {
                 return;
             }
 
-            Node *current = m_head_;
-            Node *prev = nullptr;
-            Node *next;
+            note_reshape();
+            other.note_reshape();
+            Chain merged = {m_head_, m_tail_};
+            Chain incoming = {other.m_head_, other.m_tail_};
+            m_size_ += other.m_size_;
+            other.m_head_ = other.m_tail_ = nullptr;
+            other.m_size_ = 0;
 
-            while (current != nullptr)
+            if constexpr (canThrow == CanThrow::Throw)
             {
-                next = XOR(prev, current->npx);
-                deallocate_node(current);
-                prev = current;
-                current = next;
+                try
+                {
+                    merge_chains(merged, incoming, comp);
+                }
+                catch (...)
+                {
+                    m_head_ = merged.head;
+                    m_tail_ = merged.tail;
+                    throw;
+                }
+            }
+            else
+            {
+                merge_chains(merged, incoming, comp);
             }
 
-            m_head_ = m_tail_ = nullptr;
-            m_size_ = 0;
-        }
-
-        iterator insert(const_iterator pos, const T &value) noexcept(canThrow == CanThrow::NoThrow)
-        {
-            return emplace(pos, value);
+            m_head_ = merged.head;
+            m_tail_ = merged.tail;
         }
 
-        iterator insert(const_iterator pos, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        template <class Compare>
+        void merge(XORList &&other, Compare comp) noexcept(canThrow == CanThrow::NoThrow)
         {
-            return emplace(pos, std::move(value));
+            merge(other, comp);
         }
 
-        iterator insert(const_iterator pos, size_t count, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        void splice(size_t position, XORList &other_list) noexcept(canThrow == CanThrow::NoThrow)
         {
-            if (count == 0)
-                return pos;
+            if (position > m_size_)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::out_of_range("Position out of range");
+                }
+                else
+                {
+                    return; // No operation on out of range position
+                }
+            }
 
-            iterator it = pos;
-            for (size_t i = 0; i < count; ++i)
+            if (&other_list == this)
             {
-                it = emplace(it, value);
-                ++it;
+                return;
             }
-            return pos;
+
+            splice(iterator_at(position), other_list);
         }
 
-        template <class InputIt, typename = std::_RequireInputIter<InputIt>>
-        iterator insert(const_iterator pos, InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        // The splice overloads relink nodes in O(1) through the (prev, current) pair held by `pos`. Since the element
+        // in front of `pos` changes, `pos` itself goes stale; the returned iterator refers to the same element and
+        // is valid. Iterators on either side of a moved range in `other` are invalidated as well.
+        iterator splice(const_iterator pos, XORList &other) noexcept
         {
-            if (first == last)
-                return pos;
+            return splice(pos, other, other.cbegin(), other.cend());
+        }
+
+        iterator splice(const_iterator pos, XORList &&other) noexcept
+        {
+            return splice(pos, other);
+        }
 
-            iterator it = pos;
-            for (InputIt i = first; i != last; ++i)
+        iterator splice(const_iterator pos, XORList &other, const_iterator it) noexcept
+        {
+            if (it == other.cend())
             {
-                it = emplace(it, *i);
-                ++it;
+                return iterator(const_cast<Node *>(pos.prev_), const_cast<Node *>(pos.current_), this);
             }
-            return pos;
+
+            const_iterator next = it;
+            return splice(pos, other, it, ++next);
         }
 
-        iterator insert(const_iterator pos, std::initializer_list<T> ilist) noexcept(canThrow == CanThrow::NoThrow)
+        iterator splice(const_iterator pos, XORList &&other, const_iterator it) noexcept
         {
-            return insert(pos, ilist.begin(), ilist.end());
+            return splice(pos, other, it);
         }
 
-        template <class... Args>
-        iterator emplace(const_iterator pos, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        // Moves [first, last) of `other` in front of `pos`. Only a range taken from another list, and not spanning
+        // the whole of it, costs a walk over the range to keep both sizes exact.
+        iterator splice(const_iterator pos, XORList &other, const_iterator first, const_iterator last) noexcept
         {
-            if (pos == cbegin())
-            {
-                emplace_front(std::forward<Args>(args)...);
-                return begin();
-            }
-            if (pos == cend())
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            if (first == last || (&other == this && (current == first.current_ || current == last.current_)))
             {
-                emplace_back(std::forward<Args>(args)...);
-                return --end();
+                return iterator(prev, current, this);
             }
 
-            Node *newNode = allocate_node(T(std::forward<Args>(args)...));
-            if (!newNode)
+            size_t count = 0;
+            if (&other != this)
             {
-                return end();
+                if (first.prev_ == nullptr && last.current_ == nullptr)
+                {
+                    count = other.m_size_;
+                }
+                else
+                {
+                    for (const_iterator it = first; it != last; ++it)
+                    {
+                        ++count;
+                    }
+                }
             }
 
-            Node *prev = const_cast<Node *>(pos.prev_);
-            Node *current = const_cast<Node *>(pos.current_);
-            Node *next = XOR(prev, current->npx);
-
-            newNode->npx = XOR(prev, current);
-            prev->npx = XOR(XOR(prev->npx, current), newNode);
-            current->npx = XOR(newNode, next);
+            Chain chain = other.unlink_range(const_cast<Node *>(first.prev_), const_cast<Node *>(first.current_),
+                                             const_cast<Node *>(last.prev_), const_cast<Node *>(last.current_));
+            other.m_size_ -= count;
+            link_chain(prev, current, chain);
+            m_size_ += count;
 
-            ++m_size_;
-            return iterator(prev, newNode, this);
+            return iterator(chain.tail, current, this);
         }
 
-        iterator erase(const_iterator pos) noexcept(canThrow == CanThrow::NoThrow)
+        iterator splice(const_iterator pos, XORList &&other, const_iterator first, const_iterator last) noexcept
         {
-            if (pos == cend())
-            {
-                return end();
-            }
-
-            Node *prev = const_cast<Node *>(pos.prev_);
-            Node *current = const_cast<Node *>(pos.current_);
-            Node *next = XOR(prev, current->npx);
+            return splice(pos, other, first, last);
+        }
 
-            if (prev != nullptr)
-            {
-                prev->npx = XOR(XOR(prev->npx, current), next);
-            }
-            else
-            {
-                m_head_ = next;
-            }
+        size_t remove(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            size_t count = 0;
+            Node *prev = nullptr;
+            Node *current = m_head_;
+            Node *next = nullptr;
 
-            if (next != nullptr)
-            {
-                next->npx = XOR(prev, XOR(current, next->npx));
-            }
-            else
+            while (current != nullptr)
             {
-                m_tail_ = prev;
+                next = XOR(prev, current->npx);
+                if (current->data == value)
+                {
+                    if (prev != nullptr)
+                    {
+                        prev->npx = XOR(XOR(prev->npx, current), next);
+                    }
+                    else
+                    {
+                        m_head_ = next;
+                    }
+                    if (next != nullptr)
+                    {
+                        next->npx = XOR(prev, XOR(current, next->npx));
+                    }
+                    else
+                    {
+                        m_tail_ = prev;
+                    }
+                    deallocate_node(current);
+                    --m_size_;
+                    ++count;
+                    note_reshape();
+                }
+                else
+                {
+                    prev = current;
+                }
+                current = next;
             }
-
-            deallocate_node(current);
-            --m_size_;
-
-            return iterator(prev, next, this);
+            return count;
         }
 
-        iterator erase(const_iterator first, const_iterator last) noexcept(canThrow == CanThrow::NoThrow)
+        template <class UnaryPredicate>
+        size_t remove_if(UnaryPredicate p) noexcept(canThrow == CanThrow::NoThrow)
         {
-            if (first == last)
-            {
-                //  If [first, last) is an empty range, then last is returned.
-                return iterator(const_cast<Node *>(last.prev_), const_cast<Node *>(last.current_), this);
-            }
-
-            Node *first_prev = const_cast<Node *>(first.prev_);
-            Node *last_current = const_cast<Node *>(last.current_);
-            Node *last_next = XOR(last_current->npx, const_cast<Node *>(last.prev_));
-            Node *current = const_cast<Node *>(first.current_);
-            Node *current_prev = first_prev;
-            Node *current_backup = current;
+            size_t count = 0;
+            Node *prev = nullptr;
+            Node *current = m_head_;
+            Node *next = nullptr;
 
-            while (current != last_current)
+            while (current != nullptr)
             {
-                Node *next = XOR(current_prev, current->npx);
-                current_prev = current;
-                deallocate_node(current);
+                next = XOR(prev, current->npx);
+                if (p(current->data))
+                {
+                    if (prev != nullptr)
+                    {
+                        prev->npx = XOR(XOR(prev->npx, current), next);
+                    }
+                    else
+                    {
+                        m_head_ = next;
+                    }
+                    if (next != nullptr)
+                    {
+                        next->npx = XOR(prev, XOR(current, next->npx));
+                    }
+                    else
+                    {
+                        m_tail_ = prev;
+                    }
+                    deallocate_node(current);
+                    --m_size_;
+                    ++count;
+                    note_reshape();
+                }
+                else
+                {
+                    prev = current;
+                }
                 current = next;
-                --m_size_;
-            }
-
-            if (first_prev != nullptr)
-            {
-                first_prev->npx = XOR(XOR(first_prev->npx, current_backup), last_current);
-            }
-            else
-            {
-                last_current->npx = XOR(first_prev, last_next);
-                m_head_ = last_current;
-            }
-
-            if (last_current != nullptr)
-            {
-                last_current->npx = XOR(first_prev, XOR(const_cast<Node *>(last.prev_), last_current->npx));
-            }
-            else
-            {
-                first_prev->npx = XOR(XOR(first_prev->npx, current_backup), last_current);
-                m_tail_ = first_prev;
             }
+            return count;
+        }
 
-            return iterator(first_prev, last_current, this);
+        void reverse() noexcept
+        {
+            note_reshape();
+            Node *temp = m_head_;
+            m_head_ = m_tail_;
+            m_tail_ = temp;
         }
 
-        void push_back(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        // Reverses [first, last) in O(1): interior nodes keep their npx since prev ^ next is symmetric, so only the
+        // two ends of the range and their outer neighbours are relinked. Like splice, returns the refreshed `last`.
+        iterator reverse(const_iterator first, const_iterator last) noexcept
         {
-            Node *newNode = allocate_node(value);
-            if (!newNode)
+            Node *before = const_cast<Node *>(first.prev_);
+            Node *front = const_cast<Node *>(first.current_);
+            Node *back = const_cast<Node *>(last.prev_);
+            Node *after = const_cast<Node *>(last.current_);
+            if (first == last)
             {
-                return; // No operation on allocation failure
+                return iterator(back, after, this);
             }
 
-            newNode->npx = m_tail_;
+            note_reshape();
+            front->npx = XOR(front->npx, XOR(before, after));
+            back->npx = XOR(back->npx, XOR(after, before));
 
-            if (m_tail_ != nullptr)
+            if (before != nullptr)
             {
-                m_tail_->npx = XOR(newNode, m_tail_->npx);
+                before->npx = XOR(XOR(before->npx, front), back);
             }
             else
             {
-                m_head_ = newNode;
-            }
-
-            m_tail_ = newNode;
-            ++m_size_;
-        }
-
-        void push_back(T &&value) noexcept(canThrow == CanThrow::NoThrow)
-        {
-            Node *newNode = allocate_node(std::forward<T>(value));
-            if (!newNode)
-            {
-                return; // No operation on allocation failure
+                m_head_ = back;
             }
-
-            newNode->npx = m_tail_;
-
-            if (m_tail_ != nullptr)
+            if (after != nullptr)
             {
-                m_tail_->npx = XOR(newNode, m_tail_->npx);
+                after->npx = XOR(XOR(after->npx, back), front);
             }
             else
             {
-                m_head_ = newNode;
+                m_tail_ = front;
             }
 
-            m_tail_ = newNode;
-            ++m_size_;
+            return iterator(front, after, this);
         }
 
-        template <class... Args>
-        T &emplace_back(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        // Cuts the list in front of `pos` and returns [pos, end) as a new list sharing this list's allocator.
+        // Only the two nodes at the cut are relinked, but the halves still have to be sized: with an index the
+        // position of `pos` is looked up in O(n / stride + stride); without one, a walk outward from `pos` in both
+        // directions stops at the nearer end, so it reads min(k, n - k) nodes.
+        XORList split(const_iterator pos) noexcept(canThrow == CanThrow::NoThrow)
         {
-            Node *newNode = allocate_node(T(std::forward<Args>(args)...));
-            if (!newNode)
+            XORList rest(get_allocator());
+            Node *prev = const_cast<Node *>(pos.prev_);
+            Node *current = const_cast<Node *>(pos.current_);
+            if (current == nullptr)
             {
-                return m_tail_->data; // undefined behavior
+                return rest;
             }
 
-            newNode->npx = m_tail_;
-
-            if (m_tail_ != nullptr)
+            size_t count = 0;
+            size_t position;
+            refresh_index();
+            if (locate(prev, current, position))
             {
-                m_tail_->npx = XOR(newNode, m_tail_->npx);
+                count = m_size_ - position;
             }
             else
             {
-                m_head_ = newNode;
-            }
-
-            m_tail_ = newNode;
-            ++m_size_;
-            return newNode->data;
-        }
-
-        void pop_back() noexcept(canThrow == CanThrow::NoThrow)
-        {
-            if (empty())
-            {
-                if constexpr (canThrow == CanThrow::Throw)
-                {
-                    throw std::runtime_error("List is empty");
-                }
-                else
+                for (Node *ahead_prev = prev, *ahead = current, *behind_next = current, *behind = prev;; ++count)
                 {
-                    return; // No operation on empty list
+                    if (ahead == nullptr)
+                    {
+                        break;
+                    }
+                    if (behind == nullptr)
+                    {
+                        count = m_size_ - count;
+                        break;
+                    }
+                    Node *next = XOR(ahead_prev, ahead->npx);
+                    ahead_prev = ahead;
+                    ahead = next;
+                    next = XOR(behind->npx, behind_next);
+                    behind_next = behind;
+                    behind = next;
                 }
             }
 
-            Node *temp = m_tail_;
-            Node *prev = XOR(nullptr, m_tail_->npx);
+            note_reshape();
+            current->npx = XOR(current->npx, prev);
+            rest.m_head_ = current;
+            rest.m_tail_ = m_tail_;
+            rest.m_size_ = count;
 
             if (prev != nullptr)
             {
-                prev->npx = XOR(temp, prev->npx);
+                prev->npx = XOR(prev->npx, current);
             }
             else
             {
                 m_head_ = nullptr;
             }
-
             m_tail_ = prev;
-            deallocate_node(temp);
-            --m_size_;
+            m_size_ -= count;
+            return rest;
         }
 
-        void push_front(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        // Makes `new_first` the head in O(1) by linking the old tail to the old head and cutting in front of
+        // `new_first`. Returns an iterator to the old first element, as std::rotate does.
+        iterator rotate(const_iterator new_first) noexcept
         {
-            Node *newNode = allocate_node(value);
-            if (!newNode)
-            {
-                return; // No operation on allocation failure
-            }
-
-            newNode->npx = m_head_;
-
-            if (m_head_ != nullptr)
+            Node *prev = const_cast<Node *>(new_first.prev_);
+            Node *current = const_cast<Node *>(new_first.current_);
+            if (prev == nullptr)
             {
-                m_head_->npx = XOR(newNode, m_head_->npx);
+                return end();
             }
-            else
+            if (current == nullptr)
             {
-                m_tail_ = newNode;
+                return begin();
             }
 
-            m_head_ = newNode;
-            ++m_size_;
+            note_reshape();
+            m_tail_->npx = XOR(m_tail_->npx, m_head_);
+            m_head_->npx = XOR(m_head_->npx, m_tail_);
+            prev->npx = XOR(prev->npx, current);
+            current->npx = XOR(current->npx, prev);
+
+            Node *old_head = m_head_;
+            Node *old_tail = m_tail_;
+            m_head_ = current;
+            m_tail_ = prev;
+            return iterator(old_tail, old_head, this);
         }
 
-        void push_front(T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        void unique() noexcept(canThrow == CanThrow::NoThrow)
         {
-            Node *newNode = allocate_node(std::forward<T>(value));
-            if (!newNode)
+            if (m_size_ < 2)
             {
-                return; // No operation on allocation failure
+                return;
             }
 
-            newNode->npx = m_head_;
+            Node *prev = nullptr;
+            Node *current = m_head_;
+            Node *next = XOR(prev, current->npx);
 
-            if (m_head_ != nullptr)
-            {
-                m_head_->npx = XOR(newNode, m_head_->npx);
-            }
-            else
+            while (next != nullptr)
             {
-                m_tail_ = newNode;
+                if (current->data == next->data)
+                {
+                    Node *next_next = XOR(current, next->npx);
+                    current->npx = XOR(prev, next_next);
+
+                    if (next_next != nullptr)
+                    {
+                        next_next->npx = XOR(current, XOR(next, next_next->npx));
+                    }
+                    else
+                    {
+                        m_tail_ = current;
+                    }
+
+                    deallocate_node(next);
+                    next = next_next;
+                    --m_size_;
+                    note_reshape();
+                }
+                else
+                {
+                    prev = current;
+                    current = next;
+                    next = XOR(prev, current->npx);
+                }
             }
+        }
 
-            m_head_ = newNode;
-            ++m_size_;
+        void sort() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            sort(std::less<>());
         }
 
-        template <class... Args>
-        T &emplace_front(Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        // Stable bottom-up natural merge sort that relinks nodes and never moves an element.
+        // Descending runs are taken whole and reversed in O(1), so presorted input in either direction is linear.
+        // If `comp` throws, every node is kept in the list but the order is unspecified.
+        template <class Compare>
+        void sort(Compare comp) noexcept(canThrow == CanThrow::NoThrow)
         {
-            Node *newNode = allocate_node(T(std::forward<Args>(args)...));
-            if (!newNode)
+            if (m_size_ < 2)
             {
-                return m_head_->data; // undefined behavior
+                return;
             }
 
-            newNode->npx = m_head_;
+            note_reshape();
 
-            if (m_head_ != nullptr)
+            // buckets[i] holds a sorted chain built from about 2^i runs; lower buckets hold later input.
+            Chain buckets[std::numeric_limits<size_t>::digits] = {};
+            size_t levels = 0;
+            Chain carry = {nullptr, nullptr};
+            Chain input = {m_head_, m_tail_};
+
+            if constexpr (canThrow == CanThrow::Throw)
             {
-                m_head_->npx = XOR(newNode, m_head_->npx);
+                try
+                {
+                    sort_runs(buckets, levels, carry, input, comp);
+                }
+                catch (...)
+                {
+                    for (size_t level = 0; level < levels; ++level)
+                    {
+                        append_chain(carry, buckets[level]);
+                    }
+                    append_chain(carry, input);
+                    m_head_ = carry.head;
+                    m_tail_ = carry.tail;
+                    throw;
+                }
             }
             else
             {
-                m_tail_ = newNode;
+                sort_runs(buckets, levels, carry, input, comp);
             }
 
-            m_head_ = newNode;
-            ++m_size_;
-            return newNode->data;
+            m_head_ = carry.head;
+            m_tail_ = carry.tail;
         }
 
-        void pop_front() noexcept(canThrow == CanThrow::NoThrow)
+        // Default lookahead, in nodes, of the prefetching algorithms below.
+        static constexpr size_t prefetch_distance = 8;
+
+        // Traversal algorithms that prefetch `distance` nodes ahead of the visit (0 turns prefetching off). They
+        // match their <algorithm>/<numeric> namesakes over begin()/end().
+        template <class UnaryFunction>
+        UnaryFunction for_each(UnaryFunction f, size_t distance = prefetch_distance)
         {
-            if (empty())
+            auto apply = [&](const Node *node)
             {
-                if constexpr (canThrow == CanThrow::Throw)
-                {
-                    throw std::runtime_error("List is empty");
-                }
-                else
-                {
-                    return; // No operation on empty list
-                }
-            }
+                f(const_cast<Node *>(node)->data);
+                return false;
+            };
+            walk_prefetching(apply, distance);
+            return f;
+        }
 
-            Node *temp = m_head_;
-            Node *next = XOR(nullptr, m_head_->npx);
+        template <class UnaryFunction>
+        UnaryFunction for_each(UnaryFunction f, size_t distance = prefetch_distance) const
+        {
+            auto apply = [&](const Node *node)
+            {
+                f(node->data);
+                return false;
+            };
+            walk_prefetching(apply, distance);
+            return f;
+        }
+
+        template <class UnaryPredicate>
+        iterator find_if(UnaryPredicate pred, size_t distance = prefetch_distance)
+        {
+            auto found = std::as_const(*this).find_if(pred, distance);
+            return iterator(const_cast<Node *>(found.prev_), const_cast<Node *>(found.current_), this);
+        }
 
-            if (next != nullptr)
-            {
-                next->npx = XOR(temp, next->npx);
-            }
-            else
+        template <class UnaryPredicate>
+        const_iterator find_if(UnaryPredicate pred, size_t distance = prefetch_distance) const
+        {
+            auto matches = [&](const Node *node)
             {
-                m_tail_ = nullptr;
-            }
+                return static_cast<bool>(pred(node->data));
+            };
+            auto found = walk_prefetching(matches, distance);
+            return const_iterator(found.first, found.second, this);
+        }
 
-            m_head_ = next;
-            deallocate_node(temp);
-            --m_size_;
+        iterator find(const T &value, size_t distance = prefetch_distance)
+        {
+            auto found = std::as_const(*this).find(value, distance);
+            return iterator(const_cast<Node *>(found.prev_), const_cast<Node *>(found.current_), this);
         }
 
-        void resize(size_t count, const T &value = T()) noexcept(canThrow == CanThrow::NoThrow)
+        const_iterator find(const T &value, size_t distance = prefetch_distance) const
         {
-            if (count < m_size_)
+            auto equals = [&](const T &element)
             {
-                while (m_size_ > count)
-                {
-                    pop_back();
-                }
-            }
-            else if (count > m_size_)
+                return element == value;
+            };
+            return find_if(equals, distance);
+        }
+
+        template <class UnaryPredicate>
+        size_t count_if(UnaryPredicate pred, size_t distance = prefetch_distance) const
+        {
+            size_t matches = 0;
+            auto tally = [&](const Node *node)
             {
-                while (m_size_ < count)
+                if (pred(node->data))
                 {
-                    push_back(value);
+                    ++matches;
                 }
-            }
+                return false;
+            };
+            walk_prefetching(tally, distance);
+            return matches;
         }
 
-        void swap(XORList &other) noexcept
+        size_t count(const T &value, size_t distance = prefetch_distance) const
         {
-            using std::swap;
-
-            if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_swap::value)
+            auto equals = [&](const T &element)
             {
-                swap(alloc_, other.alloc_);
-            }
-
-            swap(m_head_, other.m_head_);
-            swap(m_tail_, other.m_tail_);
-            swap(m_size_, other.m_size_);
+                return element == value;
+            };
+            return count_if(equals, distance);
         }
 
-        void merge(XORList<T> &other_list) noexcept
+        template <class Init, class BinaryOperation = std::plus<>>
+        Init accumulate(Init init, BinaryOperation op = BinaryOperation(), size_t distance = prefetch_distance) const
         {
-            if (other_list.empty())
+            auto fold = [&](const Node *node)
             {
-                return;
-            }
+                init = op(std::move(init), node->data);
+                return false;
+            };
+            walk_prefetching(fold, distance);
+            return init;
+        }
 
-            if (empty())
+        // Searches from both ends in lockstep and returns the first match from the front, like find/find_if.
+        // Two chains of loads are in flight per step, so on long lists the latency to reach a match roughly
+        // halves when it sits in the front half, and the whole walk stops at the middle otherwise.
+        template <class UnaryPredicate>
+        iterator find_if_bidirectional(UnaryPredicate pred)
+        {
+            auto found = std::as_const(*this).find_if_bidirectional(pred);
+            return iterator(const_cast<Node *>(found.prev_), const_cast<Node *>(found.current_), this);
+        }
+
+        template <class UnaryPredicate>
+        const_iterator find_if_bidirectional(UnaryPredicate pred) const
+        {
+            auto matches = [&](const Node *node)
             {
-                m_head_ = other_list.m_head_;
-                m_tail_ = other_list.m_tail_;
-                m_size_ = other_list.m_size_;
-                other_list.m_head_ = other_list.m_tail_ = nullptr;
-                other_list.m_size_ = 0;
-                return;
-            }
+                return static_cast<bool>(pred(node->data));
+            };
+            auto found = walk_bidirectional(matches);
+            return const_iterator(found.first, found.second, this);
+        }
 
-            m_tail_->npx = XOR(XOR(m_tail_->npx, nullptr), other_list.m_head_);
-            other_list.m_head_->npx = XOR(m_tail_, other_list.m_head_->npx);
+        iterator find_bidirectional(const T &value)
+        {
+            auto found = std::as_const(*this).find_bidirectional(value);
+            return iterator(const_cast<Node *>(found.prev_), const_cast<Node *>(found.current_), this);
+        }
 
-            m_tail_ = other_list.m_tail_;
-            m_size_ += other_list.m_size_;
+        const_iterator find_bidirectional(const T &value) const
+        {
+            auto equals = [&](const T &element)
+            {
+                return element == value;
+            };
+            return find_if_bidirectional(equals);
+        }
 
-            other_list.m_head_ = other_list.m_tail_ = nullptr;
-            other_list.m_size_ = 0;
+        // Parallel traversals: the list is cut into one span per thread (`threads` = 0 uses every hardware thread)
+        // and each span is walked on its own thread. Lists too short to pay for the threads run on the calling thread.
+        // The cuts are taken from the index. On a non-const list the first call enables one if there is none (a
+        // checkpoint every 4096 elements, kept current by the list like any index; disable_index() drops it) and
+        // rebuilds it after structural changes, a serial walk of the whole list that later calls skip. Const calls
+        // never write to the list: with a current index they split without walking, otherwise each call walks up to
+        // the last cut, (threads - 1) / threads of the list. `f` and `pred` are called concurrently and must be safe
+        // to call that way; the first exception thrown by any of them is rethrown once every thread has finished.
+        template <class UnaryFunction>
+        void parallel_for_each(UnaryFunction f, size_t threads = 0)
+        {
+            prepare_parallel();
+            std::vector<Span> spans = split_spans(parallel_threads(threads));
+            auto work = [&](const Span &span, size_t)
+            {
+                auto apply = [&](const Node *node)
+                {
+                    f(const_cast<Node *>(node)->data);
+                };
+                walk_span(span, apply);
+            };
+            run_parallel(spans, work);
         }
 
-        void splice(size_t position, XORList<T> &other_list) noexcept(canThrow == CanThrow::NoThrow)
+        template <class UnaryFunction>
+        void parallel_for_each(UnaryFunction f, size_t threads = 0) const
         {
-            if (position > m_size_)
+            std::vector<Span> spans = split_spans(parallel_threads(threads));
+            auto work = [&](const Span &span, size_t)
             {
-                if constexpr (canThrow == CanThrow::Throw)
+                auto apply = [&](const Node *node)
                 {
-                    throw std::out_of_range("Position out of range");
-                }
-                else
+                    f(node->data);
+                };
+                walk_span(span, apply);
+            };
+            run_parallel(spans, work);
+        }
+
+        // Like std::reduce: `op` must be associative, since each span is folded separately (starting from its first
+        // element) and the per-span results are then folded into `init` in list order.
+        template <class Init, class BinaryOperation = std::plus<>>
+        Init parallel_reduce(Init init, BinaryOperation op = BinaryOperation(), size_t threads = 0)
+        {
+            prepare_parallel();
+            return std::as_const(*this).parallel_reduce(std::move(init), std::move(op), threads);
+        }
+
+        template <class Init, class BinaryOperation = std::plus<>>
+        Init parallel_reduce(Init init, BinaryOperation op = BinaryOperation(), size_t threads = 0) const
+        {
+            std::vector<Span> spans = split_spans(parallel_threads(threads));
+            std::vector<std::optional<Init>> partials(spans.size());
+            auto work = [&](const Span &span, size_t i)
+            {
+                Init partial = span.first->data;
+                const Node *prev = span.first;
+                const Node *current = XOR(span.prev, span.first->npx);
+                for (size_t step = 1; step < span.count; ++step)
                 {
-                    return; // No operation on out of range position
+                    partial = op(std::move(partial), current->data);
+                    const Node *next = XOR(prev, current->npx);
+                    prev = current;
+                    current = next;
                 }
-            }
-
-            if (other_list.empty())
+                partials[i] = std::move(partial);
+            };
+            run_parallel(spans, work);
+            for (std::optional<Init> &partial : partials)
             {
-                return;
+                init = op(std::move(init), std::move(*partial));
             }
+            return init;
+        }
+
+        template <class UnaryPredicate>
+        size_t parallel_count_if(UnaryPredicate pred, size_t threads = 0)
+        {
+            prepare_parallel();
+            return std::as_const(*this).parallel_count_if(std::move(pred), threads);
+        }
 
-            if (position == 0)
+        template <class UnaryPredicate>
+        size_t parallel_count_if(UnaryPredicate pred, size_t threads = 0) const
+        {
+            std::vector<Span> spans = split_spans(parallel_threads(threads));
+            std::vector<size_t> counts(spans.size());
+            auto work = [&](const Span &span, size_t i)
             {
-                if (m_head_ != nullptr)
-                {
-                    other_list.m_tail_->npx = XOR(other_list.m_tail_->npx, m_head_);
-                    m_head_->npx = XOR(other_list.m_tail_, XOR(nullptr, m_head_->npx));
-                }
-                else
+                size_t matches = 0;
+                auto tally = [&](const Node *node)
                 {
-                    m_tail_ = other_list.m_tail_;
-                }
-
-                m_head_ = other_list.m_head_;
-            }
-            else if (position == m_size_)
+                    if (pred(node->data))
+                    {
+                        ++matches;
+                    }
+                };
+                walk_span(span, tally);
+                counts[i] = matches;
+            };
+            run_parallel(spans, work);
+            size_t matches = 0;
+            for (size_t count : counts)
             {
-                m_tail_->npx = XOR(m_tail_->npx, other_list.m_head_);
-                other_list.m_head_->npx = XOR(m_tail_, other_list.m_head_->npx);
-
-                m_tail_ = other_list.m_tail_;
+                matches += count;
             }
-            else
-            {
-                Node *prev = nullptr;
-                Node *current = m_head_;
-                Node *next;
+            return matches;
+        }
+    };
 
-                for (size_t i = 0; i < position; ++i)
-                {
-                    next = XOR(prev, current->npx);
-                    prev = current;
-                    current = next;
-                }
+    // Immutable snapshot of an XORList made by freeze(): the elements sit contiguously in list order, so scans run
+    // at vector speed and size(), at() and operator[] are O(1). thaw() turns it back into an XORList.
+    template <typename T, CanThrow canThrow, typename Allocator>
+    class FrozenXORList
+    {
+    private:
+        std::vector<T, Allocator> m_elements_;
 
-                Node *other_tail = other_list.m_tail_;
-                other_tail->npx = XOR(other_tail->npx, current);
-                prev->npx = XOR(XOR(prev->npx, current), other_list.m_head_);
-                other_list.m_head_->npx = XOR(prev, other_list.m_head_->npx);
-                current->npx = XOR(other_list.m_tail_, XOR(prev, current->npx));
-            }
+        friend class XORList<T, canThrow, Allocator>;
+
+        explicit FrozenXORList(std::vector<T, Allocator> &&elements) noexcept : m_elements_(std::move(elements)) {}
 
-            m_size_ += other_list.m_size_;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using const_reference = const T &;
+        using const_iterator = typename std::vector<T, Allocator>::const_iterator;
+        using iterator = const_iterator;
+        using const_reverse_iterator = typename std::vector<T, Allocator>::const_reverse_iterator;
+        using reverse_iterator = const_reverse_iterator;
+
+        FrozenXORList() = default;
 
-            other_list.m_head_ = other_list.m_tail_ = nullptr;
-            other_list.m_size_ = 0;
+        size_t size() const noexcept
+        {
+            return m_elements_.size();
         }
 
-        size_t remove(const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        bool empty() const noexcept
         {
-            size_t count = 0;
-            Node *prev = nullptr;
-            Node *current = m_head_;
-            Node *next = nullptr;
+            return m_elements_.empty();
+        }
 
-            while (current != nullptr)
+        const T &operator[](size_t position) const noexcept
+        {
+            return m_elements_[position];
+        }
+
+        const T &at(size_t position) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
             {
-                next = XOR(prev, current->npx);
-                if (current->data == value)
-                {
-                    if (prev != nullptr)
-                    {
-                        prev->npx = XOR(XOR(prev->npx, current), next);
-                    }
-                    else
-                    {
-                        m_head_ = next;
-                    }
-                    if (next != nullptr)
-                    {
-                        next->npx = XOR(prev, XOR(current, next->npx));
-                    }
-                    else
-                    {
-                        m_tail_ = prev;
-                    }
-                    deallocate_node(current);
-                    --m_size_;
-                    ++count;
-                }
-                else
+                if (position >= m_elements_.size())
                 {
-                    prev = current;
+                    throw std::out_of_range("Position out of range");
                 }
-                current = next;
             }
-            return count;
+            return m_elements_[position];
         }
 
-        template <class UnaryPredicate>
-        size_t remove_if(UnaryPredicate p) noexcept(canThrow == CanThrow::NoThrow)
+        const T &front() const noexcept(canThrow == CanThrow::NoThrow)
         {
-            size_t count = 0;
-            Node *prev = nullptr;
-            Node *current = m_head_;
-            Node *next = nullptr;
-
-            while (current != nullptr)
+            if constexpr (canThrow == CanThrow::Throw)
             {
-                next = XOR(prev, current->npx);
-                if (p(current->data))
+                if (empty())
                 {
-                    if (prev != nullptr)
-                    {
-                        prev->npx = XOR(XOR(prev->npx, current), next);
-                    }
-                    else
-                    {
-                        m_head_ = next;
-                    }
-                    if (next != nullptr)
-                    {
-                        next->npx = XOR(prev, XOR(current, next->npx));
-                    }
-                    else
-                    {
-                        m_tail_ = prev;
-                    }
-                    deallocate_node(current);
-                    --m_size_;
-                    ++count;
+                    throw std::runtime_error("List is empty");
                 }
-                else
+            }
+            return m_elements_.front();
+        }
+
+        const T &back() const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty())
                 {
-                    prev = current;
+                    throw std::runtime_error("List is empty");
                 }
-                current = next;
             }
-            return count;
+            return m_elements_.back();
         }
 
-        void reverse() noexcept
+        const T *data() const noexcept
         {
-            Node *temp = m_head_;
-            m_head_ = m_tail_;
-            m_tail_ = temp;
+            return m_elements_.data();
         }
 
-        void unique() noexcept(canThrow == CanThrow::NoThrow)
+        const_iterator begin() const noexcept
         {
-            if (m_size_ < 2)
-            {
-                return;
-            }
+            return m_elements_.cbegin();
+        }
 
-            Node *prev = nullptr;
-            Node *current = m_head_;
-            Node *next = XOR(prev, current->npx);
+        const_iterator end() const noexcept
+        {
+            return m_elements_.cend();
+        }
 
-            while (next != nullptr)
-            {
-                if (current->data == next->data)
-                {
-                    Node *next_next = XOR(current, next->npx);
-                    current->npx = XOR(prev, next_next);
+        const_iterator cbegin() const noexcept
+        {
+            return m_elements_.cbegin();
+        }
 
-                    if (next_next != nullptr)
-                    {
-                        next_next->npx = XOR(current, XOR(next, next_next->npx));
-                    }
-                    else
-                    {
-                        m_tail_ = current;
-                    }
+        const_iterator cend() const noexcept
+        {
+            return m_elements_.cend();
+        }
 
-                    deallocate_node(next);
-                    next = next_next;
-                    --m_size_;
-                }
-                else
-                {
-                    prev = current;
-                    current = next;
-                    next = XOR(prev, current->npx);
-                }
-            }
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return m_elements_.crbegin();
         }
 
-        void sort() noexcept(canThrow == CanThrow::NoThrow)
+        const_reverse_iterator rend() const noexcept
         {
-            if (m_size_ < 2)
-            {
-                return;
-            }
+            return m_elements_.crend();
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return m_elements_.get_allocator();
+        }
+
+        // Builds a mutable XORList with the same elements; all nodes come from one allocation with XORListPool.
+        XORList<T, canThrow, Allocator> thaw() const & noexcept(canThrow == CanThrow::NoThrow)
+        {
+            return XORList<T, canThrow, Allocator>(m_elements_.cbegin(), m_elements_.cend(), get_allocator());
+        }
+
+        // Like thaw() const &, but moves the elements out and leaves the snapshot empty.
+        XORList<T, canThrow, Allocator> thaw() && noexcept(canThrow == CanThrow::NoThrow)
+        {
+            XORList<T, canThrow, Allocator> list(std::make_move_iterator(m_elements_.begin()), std::make_move_iterator(m_elements_.end()),
+                                                 get_allocator());
+            m_elements_.clear();
+            return list;
+        }
 
-            std::sort(begin(), end());
+        bool operator==(const FrozenXORList &other) const
+        {
+            return m_elements_ == other.m_elements_;
+        }
+
+        bool operator!=(const FrozenXORList &other) const
+        {
+            return m_elements_ != other.m_elements_;
         }
     };
 }
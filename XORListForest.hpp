@@ -0,0 +1,847 @@
+#ifndef _SCC_XORLIST_FOREST_HPP_
+#define _SCC_XORLIST_FOREST_HPP_
+#pragma once
+
+#include <XORList.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace scc
+{
+    template <typename T, CanThrow canThrow, typename Allocator>
+    class XORListForest;
+
+    template <typename T, CanThrow canThrow, typename Allocator>
+    class CompactXORList;
+
+    namespace detail
+    {
+        // Growable array of list nodes addressed by 32-bit index.
+        //
+        // Slots live in chunks that never move, so references to elements stay valid until the element is erased.
+        // The first chunks grow geometrically from 16 slots, so a small list does not pay for a full 4096-slot
+        // chunk; past slot 4096 every chunk holds 4096 slots. A slot holds its value and the XOR of its neighbours' indices; index 0 is the null link.
+        // Freed slots are recycled through a free list threaded through their link field. The arena does not
+        // know which slots are live: its owner destroys every chain before the arena goes away.
+        template <typename T, typename Allocator>
+        class SlotArena
+        {
+        public:
+            using index_type = std::uint32_t;
+
+            // Header of one list: first and last slot and the element count.
+            struct Chain
+            {
+                index_type head;
+                index_type tail;
+                index_type size;
+            };
+
+        private:
+            static constexpr size_t kChunkBits = 12;
+            static constexpr size_t kChunkSlots = size_t(1) << kChunkBits;
+            static constexpr size_t kFirstChunkSlots = 16;
+            static constexpr size_t kSmallChunks = 9; // 16, 16, 32, ..., 2048 slots: indices [0, kChunkSlots)
+
+            struct Slot
+            {
+                alignas(T) unsigned char storage[sizeof(T)];
+                index_type npx; // XOR of next and previous slot indices; the next free slot while unused
+            };
+
+            using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+            SlotAllocator alloc_;
+            std::vector<Slot *> m_chunks_;
+            index_type m_free_;
+            index_type m_next_; // first slot never handed out yet
+
+            // Chunk holding an index below kChunkSlots: 0 for [0, 16), then one per power of two.
+            static size_t small_chunk(index_type index) noexcept
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<size_t>(28 - __builtin_clz(index | (kFirstChunkSlots - 1)));
+#else
+                size_t chunk = 0;
+                for (size_t limit = kFirstChunkSlots; index >= limit; limit <<= 1)
+                {
+                    ++chunk;
+                }
+                return chunk;
+#endif
+            }
+
+            static size_t chunk_slots(size_t chunk) noexcept
+            {
+                return chunk == 0 ? kFirstChunkSlots : chunk < kSmallChunks ? (kFirstChunkSlots / 2) << chunk : kChunkSlots;
+            }
+
+            // Slots held by the first `chunks` chunks.
+            static size_t slots_in(size_t chunks) noexcept
+            {
+                if (chunks <= kSmallChunks)
+                {
+                    return chunks == 0 ? 0 : kFirstChunkSlots << (chunks - 1);
+                }
+                return (chunks - kSmallChunks + 1) * kChunkSlots;
+            }
+
+            Slot *locate(index_type index) const noexcept
+            {
+                if (index >= kChunkSlots)
+                {
+                    return m_chunks_[kSmallChunks - 1 + (index >> kChunkBits)] + (index & (kChunkSlots - 1));
+                }
+                size_t chunk = small_chunk(index);
+                return m_chunks_[chunk] + (index - slots_in(chunk));
+            }
+
+            Slot &slot(index_type index) noexcept
+            {
+                return *locate(index);
+            }
+
+            const Slot &slot(index_type index) const noexcept
+            {
+                return *locate(index);
+            }
+
+            void grow()
+            {
+                if (slots_in(m_chunks_.size() + 1) - 1 > std::numeric_limits<index_type>::max())
+                {
+                    throw std::length_error("XORList slot arena is full");
+                }
+                if (m_chunks_.size() == m_chunks_.capacity())
+                {
+                    // Geometric, so adding chunks stays amortized O(1); done before the chunk is allocated so a
+                    // failing reserve leaks nothing.
+                    m_chunks_.reserve(std::max<size_t>(2 * m_chunks_.size(), 8));
+                }
+                m_chunks_.push_back(std::allocator_traits<SlotAllocator>::allocate(alloc_, chunk_slots(m_chunks_.size())));
+            }
+
+            index_type acquire()
+            {
+                if (m_free_ != 0)
+                {
+                    index_type index = m_free_;
+                    m_free_ = slot(index).npx;
+                    return index;
+                }
+                if (m_next_ == std::numeric_limits<index_type>::max())
+                {
+                    // Handing this one out would wrap m_next_ to 0, the null link, and then to slots still in use.
+                    throw std::length_error("XORList slot arena is full");
+                }
+                if (m_next_ >= slots_in(m_chunks_.size()))
+                {
+                    grow();
+                }
+                return m_next_++;
+            }
+
+            void release(index_type index) noexcept
+            {
+                slot(index).npx = m_free_;
+                m_free_ = index;
+            }
+
+        public:
+            static constexpr size_t slot_size = sizeof(Slot);
+
+            explicit SlotArena(const Allocator &allocator = Allocator()) noexcept
+                : alloc_(allocator), m_free_(0), m_next_(1) {}
+
+            SlotArena(const SlotArena &) = delete;
+            SlotArena &operator=(const SlotArena &) = delete;
+
+            SlotArena(SlotArena &&other) noexcept
+                : alloc_(std::move(other.alloc_)), m_chunks_(std::move(other.m_chunks_)), m_free_(other.m_free_), m_next_(other.m_next_)
+            {
+                other.m_chunks_.clear();
+                other.m_free_ = 0;
+                other.m_next_ = 1;
+            }
+
+            ~SlotArena()
+            {
+                for (size_t chunk = 0; chunk < m_chunks_.size(); ++chunk)
+                {
+                    std::allocator_traits<SlotAllocator>::deallocate(alloc_, m_chunks_[chunk], chunk_slots(chunk));
+                }
+            }
+
+            void swap(SlotArena &other) noexcept
+            {
+                using std::swap;
+                swap(alloc_, other.alloc_);
+                swap(m_chunks_, other.m_chunks_);
+                swap(m_free_, other.m_free_);
+                swap(m_next_, other.m_next_);
+            }
+
+            Allocator get_allocator() const noexcept
+            {
+                return Allocator(alloc_);
+            }
+
+            // Slots the arena can hold before it allocates another chunk.
+            size_t capacity() const noexcept
+            {
+                return m_chunks_.empty() ? 0 : slots_in(m_chunks_.size()) - 1;
+            }
+
+            // Makes room for `count` more slots so that many inserts in a row do not allocate.
+            void reserve(size_t count)
+            {
+                while (slots_in(m_chunks_.size()) < static_cast<size_t>(m_next_) + count)
+                {
+                    grow();
+                }
+            }
+
+            // Hands out `count` slots with consecutive indices, so a chain built in them is laid out in order.
+            index_type acquire_run(size_t count)
+            {
+                if (count >= static_cast<size_t>(std::numeric_limits<index_type>::max() - m_next_))
+                {
+                    throw std::length_error("XORList slot arena is full");
+                }
+                reserve(count);
+                index_type first = m_next_;
+                m_next_ += static_cast<index_type>(count);
+                return first;
+            }
+
+            // Constructs a value in a slot from acquire_run() and sets its link field to `npx`.
+            template <class... Args>
+            void construct(index_type index, index_type npx, Args &&...args)
+            {
+                ::new (static_cast<void *>(slot(index).storage)) T(std::forward<Args>(args)...);
+                slot(index).npx = npx;
+            }
+
+            // Forgets every slot, so the next ones are handed out from the start of the first chunk again. Only
+            // valid once no chain holds any slot.
+            void reset() noexcept
+            {
+                m_free_ = 0;
+                m_next_ = 1;
+            }
+
+            T &value(index_type index) noexcept
+            {
+                return *std::launder(reinterpret_cast<T *>(slot(index).storage));
+            }
+
+            const T &value(index_type index) const noexcept
+            {
+                return *std::launder(reinterpret_cast<const T *>(slot(index).storage));
+            }
+
+            index_type npx(index_type index) const noexcept
+            {
+                return slot(index).npx;
+            }
+
+            template <class... Args>
+            index_type make(Args &&...args)
+            {
+                index_type index = acquire();
+                try
+                {
+                    ::new (static_cast<void *>(slot(index).storage)) T(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    release(index);
+                    throw;
+                }
+                return index;
+            }
+
+            void destroy(index_type index) noexcept
+            {
+                value(index).~T();
+                release(index);
+            }
+
+            // Links slot `index` between the adjacent slots `prev` and `next` of `chain` (either may be 0 at the ends).
+            void link(Chain &chain, index_type prev, index_type next, index_type index) noexcept
+            {
+                slot(index).npx = prev ^ next;
+                if (prev != 0)
+                {
+                    slot(prev).npx ^= next ^ index;
+                }
+                else
+                {
+                    chain.head = index;
+                }
+                if (next != 0)
+                {
+                    slot(next).npx ^= prev ^ index;
+                }
+                else
+                {
+                    chain.tail = index;
+                }
+                ++chain.size;
+            }
+
+            // Unlinks slot `index`, whose predecessor in `chain` is `prev`, and returns its successor.
+            index_type unlink(Chain &chain, index_type prev, index_type index) noexcept
+            {
+                index_type next = prev ^ slot(index).npx;
+                if (prev != 0)
+                {
+                    slot(prev).npx ^= index ^ next;
+                }
+                else
+                {
+                    chain.head = next;
+                }
+                if (next != 0)
+                {
+                    slot(next).npx ^= index ^ prev;
+                }
+                else
+                {
+                    chain.tail = prev;
+                }
+                --chain.size;
+                return next;
+            }
+
+            // Moves all of `source` between the adjacent slots `prev` and `next` of `target`, leaving `source` empty.
+            void splice(Chain &target, index_type prev, index_type next, Chain &source) noexcept
+            {
+                if (source.size == 0)
+                {
+                    return;
+                }
+
+                slot(source.head).npx ^= prev;
+                slot(source.tail).npx ^= next;
+                if (prev != 0)
+                {
+                    slot(prev).npx ^= next ^ source.head;
+                }
+                else
+                {
+                    target.head = source.head;
+                }
+                if (next != 0)
+                {
+                    slot(next).npx ^= prev ^ source.tail;
+                }
+                else
+                {
+                    target.tail = source.tail;
+                }
+                target.size += source.size;
+                source = Chain{0, 0, 0};
+            }
+
+            void clear(Chain &chain) noexcept
+            {
+                for (index_type current = chain.head, prev = 0, next; current != 0; prev = current, current = next)
+                {
+                    next = prev ^ slot(current).npx;
+                    destroy(current);
+                }
+                chain = Chain{0, 0, 0};
+            }
+        };
+
+        template <typename T, typename Allocator, bool IsConst>
+        class SlotArenaIterator
+        {
+        private:
+            using Arena = SlotArena<T, Allocator>;
+            using ArenaType = std::conditional_t<IsConst, const Arena, Arena>;
+            using index_type = typename Arena::index_type;
+
+            ArenaType *arena_;
+            index_type prev_;
+            index_type current_;
+
+            template <typename, CanThrow, typename>
+            friend class scc::XORListForest;
+
+            template <typename, CanThrow, typename>
+            friend class scc::CompactXORList;
+
+            template <typename, typename, bool>
+            friend class SlotArenaIterator;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T *, T *>;
+            using reference = std::conditional_t<IsConst, const T &, T &>;
+
+            SlotArenaIterator() noexcept : arena_(nullptr), prev_(0), current_(0) {}
+
+            SlotArenaIterator(ArenaType *arena, index_type prev, index_type current) noexcept
+                : arena_(arena), prev_(prev), current_(current) {}
+
+            template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+            SlotArenaIterator(const SlotArenaIterator<T, Allocator, WasConst> &other) noexcept
+                : arena_(other.arena_), prev_(other.prev_), current_(other.current_) {}
+
+            reference operator*() const { return arena_->value(current_); }
+            pointer operator->() const { return &arena_->value(current_); }
+
+            SlotArenaIterator &operator++()
+            {
+                if (current_ == 0)
+                {
+                    return *this; // Already at end, do nothing
+                }
+
+                index_type next = prev_ ^ arena_->npx(current_);
+                prev_ = current_;
+                current_ = next;
+                return *this;
+            }
+
+            SlotArenaIterator operator++(int)
+            {
+                SlotArenaIterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            SlotArenaIterator &operator--()
+            {
+                if (prev_ == 0)
+                {
+                    return *this; // Already at begin, do nothing
+                }
+
+                index_type before = arena_->npx(prev_) ^ current_;
+                current_ = prev_;
+                prev_ = before;
+                return *this;
+            }
+
+            SlotArenaIterator operator--(int)
+            {
+                SlotArenaIterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            bool operator==(const SlotArenaIterator &other) const { return current_ == other.current_; }
+            bool operator!=(const SlotArenaIterator &other) const { return current_ != other.current_; }
+        };
+    }
+
+    // Many small XOR-linked lists sharing one node arena.
+    //
+    // Nodes link to each other through the XOR of 32-bit slot indices instead of pointers (see detail::SlotArena),
+    // so an XORListForest<int> spends 8 bytes per element and 12 bytes per list header. References to elements
+    // stay valid until the element is erased.
+    //
+    // Lists are addressed by their position in the forest (0 .. list_count() - 1). Elements can be spliced
+    // between lists of the same forest in O(1). The whole forest holds fewer than 2^32 elements.
+    template <typename T, CanThrow canThrow = CanThrow::NoThrow, typename Allocator = std::allocator<T>>
+    class XORListForest
+    {
+    private:
+        using Arena = detail::SlotArena<T, Allocator>;
+        using Header = typename Arena::Chain;
+
+        Arena m_arena_;
+        std::vector<Header> m_lists_;
+        size_t m_size_;
+
+    public:
+        using index_type = typename Arena::index_type;
+        using iterator = detail::SlotArenaIterator<T, Allocator, false>;
+        using const_iterator = detail::SlotArenaIterator<T, Allocator, true>;
+
+        // Bytes one element occupies in the arena.
+        static constexpr size_t node_size = Arena::slot_size;
+
+        // begin()/end() of one list, so a list can be used in a range-based for loop.
+        template <class Iterator>
+        struct ListRange
+        {
+            Iterator first;
+            Iterator last;
+
+            Iterator begin() const { return first; }
+            Iterator end() const { return last; }
+        };
+
+        explicit XORListForest(size_t lists = 0, const Allocator &allocator = Allocator()) noexcept(canThrow == CanThrow::NoThrow)
+            : m_arena_(allocator), m_lists_(lists, Header{0, 0, 0}), m_size_(0) {}
+
+        XORListForest(const XORListForest &) = delete;
+        XORListForest &operator=(const XORListForest &) = delete;
+
+        XORListForest(XORListForest &&other) noexcept
+            : m_arena_(std::move(other.m_arena_)), m_lists_(std::move(other.m_lists_)), m_size_(other.m_size_)
+        {
+            other.m_lists_.clear();
+            other.m_size_ = 0;
+        }
+
+        ~XORListForest()
+        {
+            for (Header &header : m_lists_)
+            {
+                m_arena_.clear(header);
+            }
+        }
+
+        // Adds an empty list and returns its id.
+        size_t add_list() noexcept(canThrow == CanThrow::NoThrow)
+        {
+            m_lists_.push_back(Header{0, 0, 0});
+            return m_lists_.size() - 1;
+        }
+
+        size_t list_count() const noexcept
+        {
+            return m_lists_.size();
+        }
+
+        // Total number of elements over all lists.
+        size_t total_size() const noexcept
+        {
+            return m_size_;
+        }
+
+        // Slots the arena can hold before it allocates another chunk.
+        size_t capacity() const noexcept
+        {
+            return m_arena_.capacity();
+        }
+
+        // Makes room for `count` more elements so that many pushes in a row do not allocate.
+        void reserve(size_t count) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            m_arena_.reserve(count);
+        }
+
+        size_t size(size_t list) const noexcept
+        {
+            return m_lists_[list].size;
+        }
+
+        bool empty(size_t list) const noexcept
+        {
+            return m_lists_[list].size == 0;
+        }
+
+        T &front(size_t list) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty(list))
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_lists_[list].head);
+        }
+
+        const T &front(size_t list) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty(list))
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_lists_[list].head);
+        }
+
+        T &back(size_t list) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty(list))
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_lists_[list].tail);
+        }
+
+        const T &back(size_t list) const noexcept(canThrow == CanThrow::NoThrow)
+        {
+            if constexpr (canThrow == CanThrow::Throw)
+            {
+                if (empty(list))
+                {
+                    throw std::runtime_error("List is empty");
+                }
+            }
+            return m_arena_.value(m_lists_[list].tail);
+        }
+
+        iterator begin(size_t list) noexcept
+        {
+            return iterator(&m_arena_, 0, m_lists_[list].head);
+        }
+
+        iterator end(size_t list) noexcept
+        {
+            return iterator(&m_arena_, m_lists_[list].tail, 0);
+        }
+
+        const_iterator cbegin(size_t list) const noexcept
+        {
+            return const_iterator(&m_arena_, 0, m_lists_[list].head);
+        }
+
+        const_iterator cend(size_t list) const noexcept
+        {
+            return const_iterator(&m_arena_, m_lists_[list].tail, 0);
+        }
+
+        ListRange<iterator> elements(size_t list) noexcept
+        {
+            return {begin(list), end(list)};
+        }
+
+        ListRange<const_iterator> elements(size_t list) const noexcept
+        {
+            return {cbegin(list), cend(list)};
+        }
+
+        template <class... Args>
+        T &emplace_back(size_t list, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            index_type index = m_arena_.make(std::forward<Args>(args)...);
+            Header &header = m_lists_[list];
+            m_arena_.link(header, header.tail, 0, index);
+            ++m_size_;
+            return m_arena_.value(index);
+        }
+
+        template <class... Args>
+        T &emplace_front(size_t list, Args &&...args) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            index_type index = m_arena_.make(std::forward<Args>(args)...);
+            Header &header = m_lists_[list];
+            m_arena_.link(header, 0, header.head, index);
+            ++m_size_;
+            return m_arena_.value(index);
+        }
+
+        void push_back(size_t list, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(list, value);
+        }
+
+        void push_back(size_t list, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_back(list, std::move(value));
+        }
+
+        void push_front(size_t list, const T &value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(list, value);
+        }
+
+        void push_front(size_t list, T &&value) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            emplace_front(list, std::move(value));
+        }
+
+        void pop_back(size_t list) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Header &header = m_lists_[list];
+            if (header.size == 0)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            index_type index = header.tail;
+            m_arena_.unlink(header, m_arena_.npx(index), index);
+            m_arena_.destroy(index);
+            --m_size_;
+        }
+
+        void pop_front(size_t list) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            Header &header = m_lists_[list];
+            if (header.size == 0)
+            {
+                if constexpr (canThrow == CanThrow::Throw)
+                {
+                    throw std::runtime_error("List is empty");
+                }
+                else
+                {
+                    return; // No operation on empty list
+                }
+            }
+
+            index_type index = header.head;
+            m_arena_.unlink(header, 0, index);
+            m_arena_.destroy(index);
+            --m_size_;
+        }
+
+        // Erases the element at `pos` of `list` and returns the iterator following it.
+        iterator erase(size_t list, const_iterator pos) noexcept
+        {
+            if (pos.current_ == 0)
+            {
+                return iterator(&m_arena_, pos.prev_, 0);
+            }
+
+            index_type next = m_arena_.unlink(m_lists_[list], pos.prev_, pos.current_);
+            m_arena_.destroy(pos.current_);
+            --m_size_;
+            return iterator(&m_arena_, pos.prev_, next);
+        }
+
+        void clear(size_t list) noexcept
+        {
+            m_size_ -= m_lists_[list].size;
+            m_arena_.clear(m_lists_[list]);
+        }
+
+        // Moves every element of `from` in front of `pos` in `to` in O(1). Returns the refreshed `pos`, since the
+        // element in front of it changes.
+        iterator splice(size_t to, const_iterator pos, size_t from) noexcept
+        {
+            Header &source = m_lists_[from];
+            if (to == from || source.size == 0)
+            {
+                return iterator(&m_arena_, pos.prev_, pos.current_);
+            }
+
+            index_type last = source.tail;
+            m_arena_.splice(m_lists_[to], pos.prev_, pos.current_, source);
+            return iterator(&m_arena_, last, pos.current_);
+        }
+
+        // Moves the element at `it` in `from` in front of `pos` in `to` in O(1). Returns the refreshed `pos`.
+        iterator splice(size_t to, const_iterator pos, size_t from, const_iterator it) noexcept
+        {
+            if (it.current_ == 0 || it.current_ == pos.current_ || it.current_ == pos.prev_)
+            {
+                return iterator(&m_arena_, pos.prev_, pos.current_);
+            }
+
+            m_arena_.unlink(m_lists_[from], it.prev_, it.current_);
+            m_arena_.link(m_lists_[to], pos.prev_, pos.current_, it.current_);
+            return iterator(&m_arena_, it.current_, pos.current_);
+        }
+
+    private:
+        // Second pass of assign_pairs(): the headers hold each list's length, and the lists get consecutive runs of
+        // slots starting at `next_run`. If an element constructor throws, everything built is destroyed and every
+        // list is left empty.
+        template <class ForwardIt>
+        void fill_runs(ForwardIt first, ForwardIt last, index_type next_run)
+        {
+            // While filling, `head` is the first slot of a list's run and `tail` the next slot to fill.
+            for (Header &header : m_lists_)
+            {
+                header.head = header.size != 0 ? next_run : 0;
+                header.tail = header.head;
+                next_run += header.size;
+            }
+
+            try
+            {
+                for (; first != last; ++first)
+                {
+                    Header &header = m_lists_[static_cast<size_t>(std::get<0>(*first))];
+                    index_type index = header.tail;
+                    index_type prev = index != header.head ? index - 1 : 0;
+                    index_type next = index - header.head + 1 != header.size ? index + 1 : 0;
+                    m_arena_.construct(index, prev ^ next, std::get<1>(*first));
+                    ++header.tail;
+                }
+            }
+            catch (...)
+            {
+                for (Header &header : m_lists_)
+                {
+                    for (index_type index = header.head; index != header.tail; ++index)
+                    {
+                        m_arena_.value(index).~T();
+                    }
+                    header = Header{0, 0, 0};
+                }
+                m_arena_.reset();
+                throw;
+            }
+
+            for (Header &header : m_lists_)
+            {
+                header.tail = header.size != 0 ? header.tail - 1 : 0;
+            }
+        }
+
+    public:
+        // Replaces the whole forest with `list_count` lists built from (list, value) pairs, appending each value to
+        // its list in input order. Pairs can be anything std::get<0>/std::get<1> accept, such as an edge array.
+        // A forward range is read twice: once to count each list's length, then to fill every list into its own
+        // run of consecutive slots, so each list is laid out contiguously and in order. Single-pass input is
+        // appended pair by pair.
+        template <class InputIt>
+        void assign_pairs(size_t list_count, InputIt first, InputIt last) noexcept(canThrow == CanThrow::NoThrow)
+        {
+            for (size_t id = 0; id < m_lists_.size(); ++id)
+            {
+                clear(id);
+            }
+            m_arena_.reset();
+            m_lists_.assign(list_count, Header{0, 0, 0});
+
+            using Category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+            {
+                size_t total = static_cast<size_t>(std::distance(first, last));
+                index_type next_run = m_arena_.acquire_run(total);
+                for (InputIt it = first; it != last; ++it)
+                {
+                    ++m_lists_[static_cast<size_t>(std::get<0>(*it))].size;
+                }
+
+                fill_runs(first, last, next_run);
+                m_size_ = total;
+            }
+            else
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(static_cast<size_t>(std::get<0>(*first)), std::get<1>(*first));
+                }
+            }
+        }
+    };
+}
+
+#endif // _SCC_XORLIST_FOREST_HPP_
@@ -0,0 +1,282 @@
+#ifndef _SCC_XORLIST_POOL_HPP_
+#define _SCC_XORLIST_POOL_HPP_
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace scc
+{
+    namespace detail
+    {
+        // A slab of fixed-size slots. Slots are carved from large blocks with a bump pointer and
+        // recycled through an intrusive free list, so the steady state never touches the heap.
+        class PoolArena
+        {
+        private:
+            struct FreeSlot
+            {
+                FreeSlot *next;
+            };
+
+            struct Block
+            {
+                Block *next;
+                size_t bytes;
+            };
+
+            size_t slot_size_;
+            size_t slot_align_;
+            size_t slots_per_block_;
+            size_t header_size_;
+            Block *blocks_;
+            FreeSlot *free_;
+            unsigned char *cursor_;
+            unsigned char *limit_;
+
+            static size_t round_up(size_t value, size_t align) noexcept
+            {
+                return (value + align - 1) / align * align;
+            }
+
+            void push_free(unsigned char *slot) noexcept
+            {
+                FreeSlot *freeSlot = reinterpret_cast<FreeSlot *>(slot);
+                freeSlot->next = free_;
+                free_ = freeSlot;
+            }
+
+            void grow(size_t slots)
+            {
+                // Hand the tail of the exhausted block over to the free list before moving on.
+                for (; cursor_ + slot_size_ <= limit_; cursor_ += slot_size_)
+                {
+                    push_free(cursor_);
+                }
+
+                if (slots > (std::numeric_limits<size_t>::max() - header_size_) / slot_size_)
+                {
+                    throw std::bad_alloc();
+                }
+                size_t bytes = header_size_ + slots * slot_size_;
+                Block *block = static_cast<Block *>(::operator new(bytes, std::align_val_t(slot_align_)));
+                block->next = blocks_;
+                block->bytes = bytes;
+                blocks_ = block;
+
+                cursor_ = reinterpret_cast<unsigned char *>(block) + header_size_;
+                limit_ = reinterpret_cast<unsigned char *>(block) + bytes;
+            }
+
+        public:
+            PoolArena(size_t size, size_t align, size_t slots_per_block) noexcept
+                : slot_align_(std::max(align, alignof(FreeSlot))),
+                  slots_per_block_(slots_per_block == 0 ? 1 : slots_per_block),
+                  blocks_(nullptr), free_(nullptr), cursor_(nullptr), limit_(nullptr)
+            {
+                slot_size_ = round_up(std::max(size, sizeof(FreeSlot)), slot_align_);
+                header_size_ = round_up(sizeof(Block), slot_align_);
+            }
+
+            PoolArena(const PoolArena &) = delete;
+            PoolArena &operator=(const PoolArena &) = delete;
+
+            ~PoolArena()
+            {
+                release();
+            }
+
+            bool matches(size_t size, size_t align) const noexcept
+            {
+                return slot_size_ == round_up(std::max(size, sizeof(FreeSlot)), std::max(align, alignof(FreeSlot))) &&
+                       slot_align_ == std::max(align, alignof(FreeSlot));
+            }
+
+            // Returns `count` adjacent slots. Every slot may later be given back on its own.
+            void *allocate(size_t count)
+            {
+                if (count == 1 && free_ != nullptr)
+                {
+                    FreeSlot *slot = free_;
+                    free_ = slot->next;
+                    return slot;
+                }
+
+                if (count > std::numeric_limits<size_t>::max() / slot_size_)
+                {
+                    throw std::bad_alloc(); // count * slot_size_ would wrap around
+                }
+                size_t bytes = count * slot_size_;
+                if (cursor_ == nullptr || static_cast<size_t>(limit_ - cursor_) < bytes)
+                {
+                    grow(std::max(count, slots_per_block_));
+                }
+
+                void *result = cursor_;
+                cursor_ += bytes;
+                return result;
+            }
+
+            void deallocate(void *pointer, size_t count) noexcept
+            {
+                unsigned char *slot = static_cast<unsigned char *>(pointer);
+                for (size_t i = 0; i < count; ++i, slot += slot_size_)
+                {
+                    push_free(slot);
+                }
+            }
+
+            // Makes every slot available again, keeping the newest block and freeing the others. Only valid once no
+            // slot is in use any more.
+            void reset() noexcept
+            {
+                if (blocks_ == nullptr)
+                {
+                    return;
+                }
+
+                Block *kept = blocks_;
+                blocks_ = blocks_->next;
+                release();
+                kept->next = nullptr;
+                blocks_ = kept;
+                cursor_ = reinterpret_cast<unsigned char *>(kept) + header_size_;
+                limit_ = reinterpret_cast<unsigned char *>(kept) + kept->bytes;
+            }
+
+            // Frees every block at once. Only valid once no slot is in use any more.
+            void release() noexcept
+            {
+                while (blocks_ != nullptr)
+                {
+                    Block *next = blocks_->next;
+                    ::operator delete(blocks_, blocks_->bytes, std::align_val_t(slot_align_));
+                    blocks_ = next;
+                }
+                free_ = nullptr;
+                cursor_ = limit_ = nullptr;
+            }
+        };
+
+        // Arenas shared by every copy (and rebind) of one pool, one arena per slot size.
+        class PoolState
+        {
+        private:
+            std::vector<std::unique_ptr<PoolArena>> arenas_;
+            size_t slots_per_block_;
+
+        public:
+            explicit PoolState(size_t slots_per_block) : slots_per_block_(slots_per_block) {}
+
+            PoolArena *arena_for(size_t size, size_t align)
+            {
+                for (const auto &arena : arenas_)
+                {
+                    if (arena->matches(size, align))
+                    {
+                        return arena.get();
+                    }
+                }
+                arenas_.push_back(std::make_unique<PoolArena>(size, align, slots_per_block_));
+                return arenas_.back().get();
+            }
+
+            void reset() noexcept
+            {
+                for (const auto &arena : arenas_)
+                {
+                    arena->reset();
+                }
+            }
+        };
+    } // namespace detail
+
+    // Slab allocator for XORList nodes (or any node-based container).
+    //
+    // Copies and rebinds of a pool share the same storage, so a list rebinding XORListPool<T> to its
+    // node type keeps carving nodes out of the same blocks. Memory is only returned to the system when
+    // the last copy of the pool is destroyed. Not thread-safe.
+    template <typename T, size_t SlotsPerBlock = 1024>
+    class XORListPool
+    {
+    private:
+        std::shared_ptr<detail::PoolState> state_;
+        detail::PoolArena *arena_;
+
+        template <typename U, size_t N>
+        friend class XORListPool;
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+        using piecewise_deallocation = std::true_type; // see allocate()
+
+        template <typename U>
+        struct rebind
+        {
+            using other = XORListPool<U, SlotsPerBlock>;
+        };
+
+        XORListPool()
+            : state_(std::make_shared<detail::PoolState>(SlotsPerBlock)),
+              arena_(state_->arena_for(sizeof(T), alignof(T))) {}
+
+        XORListPool(const XORListPool &other) noexcept = default;
+
+        template <typename U>
+        XORListPool(const XORListPool<U, SlotsPerBlock> &other)
+            : state_(other.state_), arena_(state_->arena_for(sizeof(T), alignof(T))) {}
+
+        XORListPool &operator=(const XORListPool &other) noexcept = default;
+
+        // A block of `count` slots may be handed back one slot at a time, so containers can allocate nodes in
+        // batches and still free them individually.
+        T *allocate(size_t count)
+        {
+            return static_cast<T *>(arena_->allocate(count));
+        }
+
+        void deallocate(T *pointer, size_t count) noexcept
+        {
+            arena_->deallocate(pointer, count);
+        }
+
+        // Takes back every slot of the pool at once, without visiting them, when this is the last copy of the pool:
+        // its owner then holds every slot still handed out. Returns false and does nothing otherwise. XORList uses
+        // this to clear lists of trivially destructible elements in O(blocks).
+        bool release_all() noexcept
+        {
+            if (state_.use_count() != 1)
+            {
+                return false;
+            }
+            state_->reset();
+            return true;
+        }
+
+        template <typename U>
+        bool operator==(const XORListPool<U, SlotsPerBlock> &other) const noexcept
+        {
+            return state_ == other.state_;
+        }
+
+        template <typename U>
+        bool operator!=(const XORListPool<U, SlotsPerBlock> &other) const noexcept
+        {
+            return state_ != other.state_;
+        }
+    };
+}
+
+#endif // _SCC_XORLIST_POOL_HPP_
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <XORList.hpp>
+#include <algorithm>
 #include <list>
 
 static constexpr auto ITERATION_COUNTS = 100000;
@@ -34,36 +35,153 @@ static void BM_StdList_Splice(benchmark::State &state)
 }
 BENCHMARK(BM_StdList_Splice);
 
-// Benchmark for XORList merge
-static void BM_XORList_Merge(benchmark::State &state)
+// Refills two lists with interleaved sorted values: evens and odds
+template <typename List>
+static void FillInterleaved(List &list1, List &list2)
 {
-    scc::XORList<int> list1, list2;
+    list1.clear();
+    list2.clear();
     for (int i = 0; i < ITERATION_COUNTS; ++i)
     {
         list1.push_back(i * 2);
         list2.push_back(i * 2 + 1);
     }
+}
+
+// Refills two lists with skewed sorted values: a long run and a short list scattered across it
+template <typename List>
+static void FillSkewed(List &list1, List &list2)
+{
+    list1.clear();
+    list2.clear();
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list1.push_back(i);
+    }
+    for (int i = 0; i < ITERATION_COUNTS / 64; ++i)
+    {
+        list2.push_back(i * 64 + 7);
+    }
+}
+
+// Benchmark for XORList merge of interleaved inputs
+static void BM_XORList_Merge(benchmark::State &state)
+{
+    scc::XORList<int> list1, list2;
     for (auto _ : state)
     {
+        state.PauseTiming();
+        FillInterleaved(list1, list2);
+        state.ResumeTiming();
         list1.merge(list2);
     }
 }
 BENCHMARK(BM_XORList_Merge);
 
-// Benchmark for std::list merge
+// Benchmark for std::list merge of interleaved inputs
 static void BM_StdList_Merge(benchmark::State &state)
 {
     std::list<int> list1, list2;
-    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    for (auto _ : state)
     {
-        list1.push_back(i * 2);
-        list2.push_back(i * 2 + 1);
+        state.PauseTiming();
+        FillInterleaved(list1, list2);
+        state.ResumeTiming();
+        list1.merge(list2);
     }
+}
+BENCHMARK(BM_StdList_Merge);
+
+// Benchmark for XORList merge of skewed inputs
+static void BM_XORList_MergeSkewed(benchmark::State &state)
+{
+    scc::XORList<int> list1, list2;
     for (auto _ : state)
     {
+        state.PauseTiming();
+        FillSkewed(list1, list2);
+        state.ResumeTiming();
         list1.merge(list2);
     }
 }
-BENCHMARK(BM_StdList_Merge);
+BENCHMARK(BM_XORList_MergeSkewed);
+
+// Benchmark for std::list merge of skewed inputs
+static void BM_StdList_MergeSkewed(benchmark::State &state)
+{
+    std::list<int> list1, list2;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        FillSkewed(list1, list2);
+        state.ResumeTiming();
+        list1.merge(list2);
+    }
+}
+BENCHMARK(BM_StdList_MergeSkewed);
+
+// Benchmark for XORList reverse of the range between the first and last element
+static void BM_XORList_ReverseRange(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        list.reverse(++list.cbegin(), --list.cend());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_XORList_ReverseRange);
+
+// Benchmark for std::reverse on std::list over the range between the first and last element
+static void BM_StdList_ReverseRange(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        std::reverse(++list.begin(), --list.end());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_StdList_ReverseRange);
+
+// Benchmark for XORList rotate by one element
+static void BM_XORList_Rotate(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        list.rotate(++list.cbegin());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_XORList_Rotate);
+
+// Benchmark for std::rotate on std::list by one element
+static void BM_StdList_Rotate(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        std::rotate(list.begin(), ++list.begin(), list.end());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_StdList_Rotate);
 
 BENCHMARK_MAIN();
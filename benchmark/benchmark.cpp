@@ -1,8 +1,26 @@
 #include <benchmark/benchmark.h>
 #include <XORList.hpp>
+#include <XORListPool.hpp>
+#include <array>
 #include <list>
+#include <string>
+#include <vector>
 
 static constexpr auto ITERATION_COUNTS = 100000;
+static constexpr auto HEAVY_COUNTS = 10000;
+static constexpr auto BULK_COUNTS = 10000000;
+
+// A large message with a heap-allocated member, so every extra copy shows up
+struct HeavyMessage
+{
+    std::array<char, 256> payload;
+    std::string topic;
+    int sequence;
+
+    HeavyMessage(int seq, const char *name) : payload(), topic(name), sequence(seq) {}
+};
+
+static constexpr auto HEAVY_TOPIC = "orders.eu-west.settlement.confirmed.v2";
 
 // Benchmark for XORList push_back
 static void BM_XORList_PushBack(benchmark::State &state)
@@ -191,4 +209,305 @@ static void BM_StdList_EmplaceBack(benchmark::State &state)
 }
 BENCHMARK(BM_StdList_EmplaceBack);
 
+// Benchmark for XORList push/pop throughput with std::allocator
+static void BM_XORList_PushPop(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_PushPop);
+
+// Benchmark for std::list push/pop throughput with std::allocator
+static void BM_StdList_PushPop(benchmark::State &state)
+{
+    std::list<int> list;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_PushPop);
+
+// Benchmark for XORList push/pop throughput with XORListPool
+static void BM_XORList_PoolPushPop(benchmark::State &state)
+{
+    scc::XORList<int, scc::CanThrow::NoThrow, scc::XORListPool<int>> list;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_PoolPushPop);
+
+// Benchmark for std::list push/pop throughput with XORListPool
+static void BM_StdList_PoolPushPop(benchmark::State &state)
+{
+    std::list<int, scc::XORListPool<int>> list;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_PoolPushPop);
+
+// Benchmark for XORList emplace_back of a heavy element
+static void BM_XORList_EmplaceBackHeavy(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        scc::XORList<HeavyMessage> list;
+        for (int i = 0; i < HEAVY_COUNTS; ++i)
+        {
+            list.emplace_back(i, HEAVY_TOPIC);
+        }
+    }
+}
+BENCHMARK(BM_XORList_EmplaceBackHeavy);
+
+// Benchmark for std::list emplace_back of a heavy element
+static void BM_StdList_EmplaceBackHeavy(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::list<HeavyMessage> list;
+        for (int i = 0; i < HEAVY_COUNTS; ++i)
+        {
+            list.emplace_back(i, HEAVY_TOPIC);
+        }
+    }
+}
+BENCHMARK(BM_StdList_EmplaceBackHeavy);
+
+// Benchmark for XORList push_back of a moved heavy element
+static void BM_XORList_PushBackMoveHeavy(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        scc::XORList<HeavyMessage> list;
+        for (int i = 0; i < HEAVY_COUNTS; ++i)
+        {
+            list.push_back(HeavyMessage(i, HEAVY_TOPIC));
+        }
+    }
+}
+BENCHMARK(BM_XORList_PushBackMoveHeavy);
+
+// Benchmark for std::list push_back of a moved heavy element
+static void BM_StdList_PushBackMoveHeavy(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::list<HeavyMessage> list;
+        for (int i = 0; i < HEAVY_COUNTS; ++i)
+        {
+            list.push_back(HeavyMessage(i, HEAVY_TOPIC));
+        }
+    }
+}
+BENCHMARK(BM_StdList_PushBackMoveHeavy);
+
+// Source values for building whole lists at once
+static const std::vector<int> &BulkSource()
+{
+    static const std::vector<int> values = []
+    {
+        std::vector<int> result(BULK_COUNTS);
+        for (int i = 0; i < BULK_COUNTS; ++i)
+        {
+            result[i] = i;
+        }
+        return result;
+    }();
+    return values;
+}
+
+// Benchmark for building an XORList from a std::vector
+static void BM_XORList_BuildFromVector(benchmark::State &state)
+{
+    const std::vector<int> &values = BulkSource();
+    for (auto _ : state)
+    {
+        scc::XORList<int> list(values.begin(), values.end());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * BULK_COUNTS);
+}
+BENCHMARK(BM_XORList_BuildFromVector)->Unit(benchmark::kMillisecond);
+
+// Benchmark for building a std::list from a std::vector
+static void BM_StdList_BuildFromVector(benchmark::State &state)
+{
+    const std::vector<int> &values = BulkSource();
+    for (auto _ : state)
+    {
+        std::list<int> list(values.begin(), values.end());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * BULK_COUNTS);
+}
+BENCHMARK(BM_StdList_BuildFromVector)->Unit(benchmark::kMillisecond);
+
+// Benchmark for building a pooled XORList from a std::vector, with every node carved out of one batch
+static void BM_XORList_PoolBuildFromVector(benchmark::State &state)
+{
+    const std::vector<int> &values = BulkSource();
+    for (auto _ : state)
+    {
+        scc::XORList<int, scc::CanThrow::NoThrow, scc::XORListPool<int>> list(values.begin(), values.end());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * BULK_COUNTS);
+}
+BENCHMARK(BM_XORList_PoolBuildFromVector)->Unit(benchmark::kMillisecond);
+
+// Benchmark for building a pooled std::list from a std::vector
+static void BM_StdList_PoolBuildFromVector(benchmark::State &state)
+{
+    const std::vector<int> &values = BulkSource();
+    for (auto _ : state)
+    {
+        std::list<int, scc::XORListPool<int>> list(values.begin(), values.end());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * BULK_COUNTS);
+}
+BENCHMARK(BM_StdList_PoolBuildFromVector)->Unit(benchmark::kMillisecond);
+
+// Benchmark for XORList copy construction
+static void BM_XORList_CopyConstruct(benchmark::State &state)
+{
+    scc::XORList<int> source(ITERATION_COUNTS, 42);
+    for (auto _ : state)
+    {
+        scc::XORList<int> copy(source);
+        benchmark::DoNotOptimize(copy.back());
+    }
+}
+BENCHMARK(BM_XORList_CopyConstruct);
+
+// Benchmark for std::list copy construction
+static void BM_StdList_CopyConstruct(benchmark::State &state)
+{
+    std::list<int> source(ITERATION_COUNTS, 42);
+    for (auto _ : state)
+    {
+        std::list<int> copy(source);
+        benchmark::DoNotOptimize(copy.back());
+    }
+}
+BENCHMARK(BM_StdList_CopyConstruct);
+
+// Benchmark for XORList copy assignment between lists of the same size
+static void BM_XORList_CopyAssign(benchmark::State &state)
+{
+    scc::XORList<int> source(ITERATION_COUNTS, 42);
+    scc::XORList<int> target(ITERATION_COUNTS, 7);
+    for (auto _ : state)
+    {
+        target = source;
+        benchmark::DoNotOptimize(target.back());
+    }
+}
+BENCHMARK(BM_XORList_CopyAssign);
+
+// Benchmark for std::list copy assignment between lists of the same size
+static void BM_StdList_CopyAssign(benchmark::State &state)
+{
+    std::list<int> source(ITERATION_COUNTS, 42);
+    std::list<int> target(ITERATION_COUNTS, 7);
+    for (auto _ : state)
+    {
+        target = source;
+        benchmark::DoNotOptimize(target.back());
+    }
+}
+BENCHMARK(BM_StdList_CopyAssign);
+
+// Benchmark for moving elements between two XORLists through node handles
+static void BM_XORList_ExtractMigrate(benchmark::State &state)
+{
+    scc::XORList<int> from(ITERATION_COUNTS, 42);
+    scc::XORList<int> to;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            to.insert(to.cend(), from.extract(from.cbegin()));
+        }
+        from.swap(to);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_ExtractMigrate);
+
+// Benchmark for moving elements between two XORLists by erasing and pushing copies
+static void BM_XORList_EraseMigrate(benchmark::State &state)
+{
+    scc::XORList<int> from(ITERATION_COUNTS, 42);
+    scc::XORList<int> to;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            to.push_back(from.front());
+            from.pop_front();
+        }
+        from.swap(to);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_EraseMigrate);
+
+// Benchmark for moving elements between two std::lists through single-element splice
+static void BM_StdList_ExtractMigrate(benchmark::State &state)
+{
+    std::list<int> from(ITERATION_COUNTS, 42);
+    std::list<int> to;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            to.splice(to.end(), from, from.begin());
+        }
+        from.swap(to);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_ExtractMigrate);
+
 BENCHMARK_MAIN();
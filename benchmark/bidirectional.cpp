@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Shuffled before sorting so consecutive elements sit far apart in memory and each step of a search is a miss.
+static constexpr auto FRAGMENTED_COUNTS = 1 << 21;
+
+template <class List>
+static void BuildFragmented(List &list)
+{
+    std::vector<int> values(FRAGMENTED_COUNTS);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    for (int value : values)
+    {
+        list.push_back(value);
+    }
+    list.sort();
+}
+
+// Values are unique and sorted, so a uniformly random target is a match at a uniformly random position.
+static std::vector<int> RandomTargets()
+{
+    std::vector<int> targets(1024);
+    std::mt19937 rng(7);
+    for (int &target : targets)
+    {
+        target = static_cast<int>(rng() % FRAGMENTED_COUNTS);
+    }
+    return targets;
+}
+
+// Benchmark for XORList::find_bidirectional of a value at a random position
+static void BM_XORList_FindBidirectional(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    BuildFragmented(list);
+    auto targets = RandomTargets();
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.find_bidirectional(targets[next++ % targets.size()]));
+    }
+}
+BENCHMARK(BM_XORList_FindBidirectional);
+
+// Benchmark for std::find over an XORList of a value at a random position
+static void BM_XORList_Find(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    BuildFragmented(list);
+    auto targets = RandomTargets();
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find(list.cbegin(), list.cend(), targets[next++ % targets.size()]));
+    }
+}
+BENCHMARK(BM_XORList_Find);
+
+// Benchmark for std::find over a std::list of a value at a random position
+static void BM_StdList_Find(benchmark::State &state)
+{
+    std::list<int> list;
+    BuildFragmented(list);
+    auto targets = RandomTargets();
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find(list.cbegin(), list.cend(), targets[next++ % targets.size()]));
+    }
+}
+BENCHMARK(BM_StdList_Find);
+
+BENCHMARK_MAIN();
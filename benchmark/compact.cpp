@@ -0,0 +1,191 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <CompactXORList.hpp>
+#include <cstddef>
+#include <list>
+#include <memory>
+
+static constexpr auto ITERATION_COUNTS = 1000000;
+
+// Allocator that tallies the bytes it hands out, so each benchmark can report memory per element. Allocator
+// bookkeeping such as malloc headers is not included.
+static size_t g_allocated_bytes = 0;
+
+template <typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+    T *allocate(size_t n)
+    {
+        g_allocated_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        g_allocated_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U> &) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const CountingAllocator<U> &) const noexcept { return false; }
+};
+
+static void ReportBytesPerElement(benchmark::State &state, size_t bytes, size_t size)
+{
+    state.counters["bytes_per_element"] = static_cast<double>(bytes) / static_cast<double>(size);
+}
+
+// Benchmark for CompactXORList push_back
+static void BM_XORList_CompactPushBack(benchmark::State &state)
+{
+    size_t bytes = 0;
+    for (auto _ : state)
+    {
+        scc::CompactXORList<int, scc::CanThrow::NoThrow, CountingAllocator<int>> list;
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        bytes = g_allocated_bytes;
+        benchmark::DoNotOptimize(list.back());
+    }
+    ReportBytesPerElement(state, bytes, ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_CompactPushBack);
+
+// Benchmark for XORList push_back
+static void BM_XORList_PushBack(benchmark::State &state)
+{
+    size_t bytes = 0;
+    for (auto _ : state)
+    {
+        scc::XORList<int, scc::CanThrow::NoThrow, CountingAllocator<int>> list;
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        bytes = g_allocated_bytes;
+        benchmark::DoNotOptimize(list.back());
+    }
+    ReportBytesPerElement(state, bytes, ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_PushBack);
+
+// Benchmark for std::list push_back
+static void BM_StdList_PushBack(benchmark::State &state)
+{
+    size_t bytes = 0;
+    for (auto _ : state)
+    {
+        std::list<int, CountingAllocator<int>> list;
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        bytes = g_allocated_bytes;
+        benchmark::DoNotOptimize(list.back());
+    }
+    ReportBytesPerElement(state, bytes, ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_PushBack);
+
+// Benchmark for CompactXORList traversal
+static void BM_XORList_CompactTraverse(benchmark::State &state)
+{
+    scc::CompactXORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (int value : list)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_CompactTraverse);
+
+// Benchmark for XORList traversal
+static void BM_XORList_Traverse(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (int value : list)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_Traverse);
+
+// Benchmark for std::list traversal
+static void BM_StdList_Traverse(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (int value : list)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_Traverse);
+
+// Benchmark for CompactXORList inserting and erasing in the middle
+static void BM_XORList_CompactInsertErase(benchmark::State &state)
+{
+    scc::CompactXORList<int> list(ITERATION_COUNTS / 100, 0);
+    auto middle = std::next(list.cbegin(), ITERATION_COUNTS / 200);
+    for (auto _ : state)
+    {
+        auto it = list.insert(middle, 42);
+        middle = list.erase(it);
+    }
+}
+BENCHMARK(BM_XORList_CompactInsertErase);
+
+// Benchmark for std::list inserting and erasing in the middle
+static void BM_StdList_InsertErase(benchmark::State &state)
+{
+    std::list<int> list(ITERATION_COUNTS / 100, 0);
+    auto middle = std::next(list.cbegin(), ITERATION_COUNTS / 200);
+    for (auto _ : state)
+    {
+        auto it = list.insert(middle, 42);
+        middle = list.erase(it);
+    }
+}
+BENCHMARK(BM_StdList_InsertErase);
+
+BENCHMARK_MAIN();
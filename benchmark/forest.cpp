@@ -0,0 +1,198 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <XORListForest.hpp>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+static constexpr auto LIST_COUNTS = 1000000;
+static constexpr auto EDGE_COUNTS = 4000000;
+
+static const std::vector<std::pair<int, int>> &Edges()
+{
+    static const std::vector<std::pair<int, int>> edges = []
+    {
+        std::mt19937 rng(42);
+        std::vector<std::pair<int, int>> result(EDGE_COUNTS);
+        for (auto &edge : result)
+        {
+            edge = {static_cast<int>(rng() % LIST_COUNTS), static_cast<int>(rng() % LIST_COUNTS)};
+        }
+        return result;
+    }();
+    return edges;
+}
+
+// Benchmark for building an adjacency list in an XORListForest
+static void BM_XORList_ForestBuild(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    for (auto _ : state)
+    {
+        scc::XORListForest<int> forest;
+        forest.assign_pairs(LIST_COUNTS, edges.begin(), edges.end());
+        benchmark::DoNotOptimize(forest.total_size());
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+}
+BENCHMARK(BM_XORList_ForestBuild);
+
+// Benchmark for building an adjacency list as a vector of XORList
+static void BM_XORList_VectorBuild(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    for (auto _ : state)
+    {
+        std::vector<scc::XORList<int>> lists(LIST_COUNTS);
+        for (const auto &[from, to] : edges)
+        {
+            lists[from].push_back(to);
+        }
+        benchmark::DoNotOptimize(lists.data());
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+}
+BENCHMARK(BM_XORList_VectorBuild);
+
+// Benchmark for building an adjacency list as a vector of std::list
+static void BM_StdList_VectorBuild(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    for (auto _ : state)
+    {
+        std::vector<std::list<int>> lists(LIST_COUNTS);
+        for (const auto &[from, to] : edges)
+        {
+            lists[from].push_back(to);
+        }
+        benchmark::DoNotOptimize(lists.data());
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+}
+BENCHMARK(BM_StdList_VectorBuild);
+
+// Benchmark for visiting every list of an XORListForest
+static void BM_XORList_ForestTraverse(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    scc::XORListForest<int> forest;
+    forest.assign_pairs(LIST_COUNTS, edges.begin(), edges.end());
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (size_t id = 0; id < forest.list_count(); ++id)
+        {
+            for (int value : forest.elements(id))
+            {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+    state.counters["bytes"] = static_cast<double>(forest.capacity() * scc::XORListForest<int>::node_size +
+                                                  forest.list_count() * 3 * sizeof(std::uint32_t));
+}
+BENCHMARK(BM_XORList_ForestTraverse);
+
+// Benchmark for visiting every list of a vector of XORList
+static void BM_XORList_VectorTraverse(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    std::vector<scc::XORList<int>> lists(LIST_COUNTS);
+    for (const auto &[from, to] : edges)
+    {
+        lists[from].push_back(to);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (auto &list : lists)
+        {
+            for (int value : list)
+            {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+    // Node payload plus one link pointer, before allocator overhead.
+    state.counters["bytes"] = static_cast<double>(EDGE_COUNTS * (sizeof(int) + sizeof(void *)) +
+                                                  LIST_COUNTS * sizeof(scc::XORList<int>));
+}
+BENCHMARK(BM_XORList_VectorTraverse);
+
+// Benchmark for visiting every list of a vector of std::list
+static void BM_StdList_VectorTraverse(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    std::vector<std::list<int>> lists(LIST_COUNTS);
+    for (const auto &[from, to] : edges)
+    {
+        lists[from].push_back(to);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (auto &list : lists)
+        {
+            for (int value : list)
+            {
+                sum += value;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * EDGE_COUNTS);
+    // Node payload plus two link pointers, before allocator overhead.
+    state.counters["bytes"] = static_cast<double>(EDGE_COUNTS * (sizeof(int) + 2 * sizeof(void *)) +
+                                                  LIST_COUNTS * sizeof(std::list<int>));
+}
+BENCHMARK(BM_StdList_VectorTraverse);
+
+// Benchmark for moving whole lists into their neighbour in an XORListForest
+static void BM_XORList_ForestSplice(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        scc::XORListForest<int> forest;
+        forest.assign_pairs(LIST_COUNTS, edges.begin(), edges.end());
+        state.ResumeTiming();
+        for (size_t id = 1; id < forest.list_count(); ++id)
+        {
+            forest.splice(0, forest.cend(0), id);
+        }
+        benchmark::DoNotOptimize(forest.size(0));
+    }
+    state.SetItemsProcessed(state.iterations() * LIST_COUNTS);
+}
+BENCHMARK(BM_XORList_ForestSplice);
+
+// Benchmark for moving whole lists into their neighbour in a vector of std::list
+static void BM_StdList_VectorSplice(benchmark::State &state)
+{
+    const auto &edges = Edges();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<std::list<int>> lists(LIST_COUNTS);
+        for (const auto &[from, to] : edges)
+        {
+            lists[from].push_back(to);
+        }
+        state.ResumeTiming();
+        for (size_t id = 1; id < lists.size(); ++id)
+        {
+            lists[0].splice(lists[0].cend(), lists[id]);
+        }
+        benchmark::DoNotOptimize(lists[0].size());
+    }
+    state.SetItemsProcessed(state.iterations() * LIST_COUNTS);
+}
+BENCHMARK(BM_StdList_VectorSplice);
+
+BENCHMARK_MAIN();
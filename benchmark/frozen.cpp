@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <list>
+#include <numeric>
+#include <random>
+
+static constexpr auto ITERATION_COUNTS = 1000000;
+
+static scc::XORList<int> MakeList()
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    return list;
+}
+
+// Benchmark for XORList scan
+static void BM_XORList_Scan(benchmark::State &state)
+{
+    auto list = MakeList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), 0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_Scan);
+
+// Benchmark for FrozenXORList scan
+static void BM_XORList_FrozenScan(benchmark::State &state)
+{
+    auto frozen = MakeList().freeze();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(frozen.cbegin(), frozen.cend(), 0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_FrozenScan);
+
+// Benchmark for std::list scan
+static void BM_StdList_Scan(benchmark::State &state)
+{
+    std::list<int> list(ITERATION_COUNTS);
+    std::iota(list.begin(), list.end(), 0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), 0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_Scan);
+
+// Benchmark for FrozenXORList at() at random positions
+static void BM_XORList_FrozenAt(benchmark::State &state)
+{
+    auto frozen = MakeList().freeze();
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(frozen.at(rng() % ITERATION_COUNTS));
+    }
+}
+BENCHMARK(BM_XORList_FrozenAt);
+
+// Benchmark for freezing a list by copy
+static void BM_XORList_Freeze(benchmark::State &state)
+{
+    auto list = MakeList();
+    for (auto _ : state)
+    {
+        auto frozen = list.freeze();
+        benchmark::DoNotOptimize(frozen.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_Freeze);
+
+// Benchmark for thawing a snapshot back into a list
+static void BM_XORList_Thaw(benchmark::State &state)
+{
+    auto frozen = MakeList().freeze();
+    for (auto _ : state)
+    {
+        auto list = frozen.thaw();
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_Thaw);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,12 @@
 #include <benchmark/benchmark.h>
 #include <XORList.hpp>
+#include <XORListPool.hpp>
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <numeric>
+#include <random>
+#include <vector>
 
 static constexpr auto ITERATION_COUNTS = 100000;
 
@@ -146,6 +152,168 @@ static void BM_StdList_Clear(benchmark::State &state)
 }
 BENCHMARK(BM_StdList_Clear);
 
+// Benchmark for XORList clear of a full list
+static void BM_XORList_ClearFull(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        state.ResumeTiming();
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_ClearFull);
+
+// Benchmark for XORList clear of a full list in its own pool, which is released in bulk
+static void BM_XORList_ClearFullPool(benchmark::State &state)
+{
+    scc::XORList<int, scc::CanThrow::NoThrow, scc::XORListPool<int>> list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        state.ResumeTiming();
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_ClearFullPool);
+
+// Benchmark for XORList clear of a full list in a pool shared with another list, which walks the nodes
+static void BM_XORList_ClearFullSharedPool(benchmark::State &state)
+{
+    scc::XORList<int, scc::CanThrow::NoThrow, scc::XORListPool<int>> list;
+    auto sharing = list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        state.ResumeTiming();
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_XORList_ClearFullSharedPool);
+
+// Benchmark for std::list clear of a full list
+static void BM_StdList_ClearFull(benchmark::State &state)
+{
+    std::list<int> list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        state.ResumeTiming();
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+}
+BENCHMARK(BM_StdList_ClearFull);
+
+// Lists whose traversal order is a random walk through memory: shuffled values are pushed in allocation order,
+// then sort() relinks the nodes without moving them. Large enough to spill out of the last-level cache.
+static constexpr auto FRAGMENTED_COUNTS = 1 << 22;
+
+template <class List>
+static void BuildFragmented(List &list)
+{
+    std::vector<int> values(FRAGMENTED_COUNTS);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    for (int value : values)
+    {
+        list.push_back(value);
+    }
+    list.sort();
+}
+
+template <class List>
+static void IterateSum(benchmark::State &state, const List &list)
+{
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+        {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+
+// Benchmark for iterating a fragmented XORList
+static void BM_XORList_IterateFragmented(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    BuildFragmented(list);
+    IterateSum(state, list);
+}
+BENCHMARK(BM_XORList_IterateFragmented);
+
+// Benchmark for iterating a fragmented XORList after compact()
+static void BM_XORList_IterateCompacted(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    BuildFragmented(list);
+    list.compact();
+    IterateSum(state, list);
+}
+BENCHMARK(BM_XORList_IterateCompacted);
+
+// Benchmark for iterating a fragmented pooled XORList after compact(), which makes its nodes one block
+static void BM_XORList_IterateCompactedPool(benchmark::State &state)
+{
+    scc::XORList<int, scc::CanThrow::NoThrow, scc::XORListPool<int>> list;
+    BuildFragmented(list);
+    list.compact();
+    IterateSum(state, list);
+}
+BENCHMARK(BM_XORList_IterateCompactedPool);
+
+// Benchmark for compacting a fragmented XORList in steps of state.range(0) nodes
+static void BM_XORList_CompactSteps(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    BuildFragmented(list);
+    auto compactor = list.make_compactor();
+    for (auto _ : state)
+    {
+        if (compactor.step(state.range(0)))
+        {
+            state.PauseTiming();
+            list.sort(std::greater<>()); // scatter again so every step has work to do
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XORList_CompactSteps)->Arg(64)->Arg(4096);
+
+// Benchmark for iterating a fragmented std::list
+static void BM_StdList_IterateFragmented(benchmark::State &state)
+{
+    std::list<int> list;
+    BuildFragmented(list);
+    IterateSum(state, list);
+}
+BENCHMARK(BM_StdList_IterateFragmented);
+
 // Benchmark for XORList begin
 static void BM_XORList_Begin(benchmark::State &state)
 {
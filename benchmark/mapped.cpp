@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#if __has_include(<sys/mman.h>)
+
+#include <XORList.hpp>
+#include <MappedXORList.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <list>
+#include <string>
+#include <vector>
+
+static constexpr auto ITERATION_COUNTS = 1000000;
+
+static std::string BenchmarkPath(const char *name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Benchmark for reopening a persisted MappedXORList and reading its front and back
+static void BM_XORList_MappedReopen(benchmark::State &state)
+{
+    std::string path = BenchmarkPath("xorlist_bench_reopen");
+    std::remove(path.c_str());
+    {
+        scc::MappedXORList<int> list(path);
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+    }
+    for (auto _ : state)
+    {
+        scc::MappedXORList<int> list(path);
+        benchmark::DoNotOptimize(list.front() + list.back());
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_XORList_MappedReopen);
+
+// Benchmark for rebuilding an XORList from a log of its elements, as a restart without persistence does
+static void BM_XORList_RebuildFromLog(benchmark::State &state)
+{
+    std::vector<int> log(ITERATION_COUNTS);
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        log[i] = i;
+    }
+    for (auto _ : state)
+    {
+        scc::XORList<int> list;
+        for (int value : log)
+        {
+            list.push_back(value);
+        }
+        benchmark::DoNotOptimize(list.front() + list.back());
+    }
+}
+BENCHMARK(BM_XORList_RebuildFromLog);
+
+// Benchmark for rebuilding a std::list from a log of its elements
+static void BM_StdList_RebuildFromLog(benchmark::State &state)
+{
+    std::vector<int> log(ITERATION_COUNTS);
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        log[i] = i;
+    }
+    for (auto _ : state)
+    {
+        std::list<int> list;
+        for (int value : log)
+        {
+            list.push_back(value);
+        }
+        benchmark::DoNotOptimize(list.front() + list.back());
+    }
+}
+BENCHMARK(BM_StdList_RebuildFromLog);
+
+// Benchmark for MappedXORList push_back into a fresh file
+static void BM_XORList_MappedPushBack(benchmark::State &state)
+{
+    std::string path = BenchmarkPath("xorlist_bench_push");
+    for (auto _ : state)
+    {
+        std::remove(path.c_str());
+        scc::MappedXORList<int> list(path);
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.back());
+    }
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_XORList_MappedPushBack);
+
+// Benchmark for traversing a MappedXORList
+static void BM_XORList_MappedTraverse(benchmark::State &state)
+{
+    std::string path = BenchmarkPath("xorlist_bench_traverse");
+    std::remove(path.c_str());
+    scc::MappedXORList<int> list(path);
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (int value : list)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ITERATION_COUNTS);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_XORList_MappedTraverse);
+
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+static constexpr auto ELEMENT_COUNTS = 10000000;
+
+static scc::XORList<int> &LargeXORList()
+{
+    static scc::XORList<int> list;
+    if (list.empty())
+    {
+        for (int i = 0; i < ELEMENT_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+    }
+    return list;
+}
+
+// Thread counts 1, 2, 4, ... up to the number of hardware threads
+static void ThreadCounts(benchmark::internal::Benchmark *benchmark)
+{
+    int limit = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int threads = 1; threads < limit; threads *= 2)
+    {
+        benchmark->Arg(threads);
+    }
+    benchmark->Arg(limit);
+}
+
+// Benchmark for a const XORList::parallel_reduce on state.range(0) threads, finding the split points with a walk
+// each call
+static void BM_XORList_ParallelReduce(benchmark::State &state)
+{
+    auto &list = LargeXORList();
+    list.disable_index();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::as_const(list).parallel_reduce(0LL, std::plus<>(), state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENT_COUNTS);
+}
+BENCHMARK(BM_XORList_ParallelReduce)->Apply(ThreadCounts)->UseRealTime();
+
+// Benchmark for XORList::parallel_reduce on state.range(0) threads, taking the split points from the index
+static void BM_XORList_ParallelReduceIndexed(benchmark::State &state)
+{
+    auto &list = LargeXORList();
+    list.parallel_reduce(0LL, std::plus<>(), state.range(0)); // enables the index outside the timed loop
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.parallel_reduce(0LL, std::plus<>(), state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENT_COUNTS);
+    list.disable_index();
+}
+BENCHMARK(BM_XORList_ParallelReduceIndexed)->Apply(ThreadCounts)->UseRealTime();
+
+// Benchmark for XORList::parallel_count_if on state.range(0) threads, taking the split points from the index
+static void BM_XORList_ParallelCountIfIndexed(benchmark::State &state)
+{
+    auto &list = LargeXORList();
+    list.parallel_reduce(0LL, std::plus<>(), state.range(0)); // enables the index outside the timed loop
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.parallel_count_if([](int value)
+                                                        { return value % 3 == 0; },
+                                                        state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENT_COUNTS);
+    list.disable_index();
+}
+BENCHMARK(BM_XORList_ParallelCountIfIndexed)->Apply(ThreadCounts)->UseRealTime();
+
+// Benchmark for a sequential XORList::accumulate, the single-thread baseline
+static void BM_XORList_Accumulate(benchmark::State &state)
+{
+    const auto &list = LargeXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.accumulate(0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENT_COUNTS);
+}
+BENCHMARK(BM_XORList_Accumulate)->UseRealTime();
+
+BENCHMARK_MAIN();
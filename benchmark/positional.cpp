@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <iterator>
+#include <list>
+#include <random>
+
+static constexpr auto ITERATION_COUNTS = 1000000;
+
+// Benchmark for XORList at() at random positions without an index
+static void BM_XORList_At(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.at(rng() % ITERATION_COUNTS));
+    }
+}
+BENCHMARK(BM_XORList_At);
+
+// Benchmark for XORList at() at random positions with a checkpoint every state.range(0) nodes
+static void BM_XORList_AtIndexed(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    list.enable_index(state.range(0));
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.at(rng() % ITERATION_COUNTS));
+    }
+}
+BENCHMARK(BM_XORList_AtIndexed)->Arg(16)->Arg(64)->Arg(256);
+
+// Benchmark for XORList at() at random positions in the back half, reached by walking from the tail
+static void BM_XORList_AtBackHalf(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.at(ITERATION_COUNTS / 2 + rng() % (ITERATION_COUNTS / 2)));
+    }
+}
+BENCHMARK(BM_XORList_AtBackHalf);
+
+// Benchmark for std::next on std::list at random positions
+static void BM_StdList_At(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(*std::next(list.begin(), rng() % ITERATION_COUNTS));
+    }
+}
+BENCHMARK(BM_StdList_At);
+
+// Benchmark for XORList cursor over slowly increasing positions
+static void BM_XORList_CursorSequential(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    auto cursor = list.make_cursor();
+    size_t position = 0;
+    for (auto _ : state)
+    {
+        position = (position + 3) % ITERATION_COUNTS;
+        benchmark::DoNotOptimize(cursor.at(position));
+    }
+}
+BENCHMARK(BM_XORList_CursorSequential);
+
+// Benchmark for std::next on std::list over slowly increasing positions
+static void BM_StdList_CursorSequential(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    size_t position = 0;
+    for (auto _ : state)
+    {
+        position = (position + 3) % ITERATION_COUNTS;
+        benchmark::DoNotOptimize(*std::next(list.begin(), position));
+    }
+}
+BENCHMARK(BM_StdList_CursorSequential);
+
+// Benchmark for indexed XORList iterator distance between random positions
+static void BM_XORList_DistanceIndexed(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    list.enable_index(64);
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    std::mt19937 rng(42);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto first = list.iterator_at(rng() % ITERATION_COUNTS);
+        auto last = list.iterator_at(rng() % ITERATION_COUNTS);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(last - first);
+    }
+}
+BENCHMARK(BM_XORList_DistanceIndexed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Larger than the last-level cache, and shuffled before sorting so consecutive elements sit far apart in memory.
+static constexpr auto FRAGMENTED_COUNTS = 1 << 22;
+
+template <class List>
+static void BuildFragmented(List &list)
+{
+    std::vector<int> values(FRAGMENTED_COUNTS);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    for (int value : values)
+    {
+        list.push_back(value);
+    }
+    list.sort();
+}
+
+static scc::XORList<int> &FragmentedXORList()
+{
+    static scc::XORList<int> list;
+    if (list.empty())
+    {
+        BuildFragmented(list);
+    }
+    return list;
+}
+
+static std::list<int> &FragmentedStdList()
+{
+    static std::list<int> list;
+    if (list.empty())
+    {
+        BuildFragmented(list);
+    }
+    return list;
+}
+
+// Benchmark for std::accumulate over the iterators of a fragmented XORList
+static void BM_XORList_StdAccumulate(benchmark::State &state)
+{
+    const auto &list = FragmentedXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), 0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_XORList_StdAccumulate);
+
+// Benchmark for XORList::accumulate with a lookahead of state.range(0) nodes
+static void BM_XORList_Accumulate(benchmark::State &state)
+{
+    const auto &list = FragmentedXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.accumulate(0LL, std::plus<>(), state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_XORList_Accumulate)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+
+// Benchmark for std::find of the last element over the iterators of a fragmented XORList
+static void BM_XORList_StdFind(benchmark::State &state)
+{
+    const auto &list = FragmentedXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find(list.cbegin(), list.cend(), FRAGMENTED_COUNTS - 1));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_XORList_StdFind);
+
+// Benchmark for XORList::find of the last element with a lookahead of state.range(0) nodes
+static void BM_XORList_Find(benchmark::State &state)
+{
+    const auto &list = FragmentedXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.find(FRAGMENTED_COUNTS - 1, state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_XORList_Find)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+
+// Benchmark for XORList::count_if with a lookahead of state.range(0) nodes
+static void BM_XORList_CountIf(benchmark::State &state)
+{
+    const auto &list = FragmentedXORList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.count_if([](int value)
+                                               { return value % 3 == 0; },
+                                               state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_XORList_CountIf)->Arg(0)->Arg(8);
+
+// Benchmark for std::accumulate over a fragmented std::list
+static void BM_StdList_Accumulate(benchmark::State &state)
+{
+    const auto &list = FragmentedStdList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), 0LL));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_StdList_Accumulate);
+
+// Benchmark for std::find of the last element over a fragmented std::list
+static void BM_StdList_Find(benchmark::State &state)
+{
+    const auto &list = FragmentedStdList();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find(list.cbegin(), list.cend(), FRAGMENTED_COUNTS - 1));
+    }
+    state.SetItemsProcessed(state.iterations() * FRAGMENTED_COUNTS);
+}
+BENCHMARK(BM_StdList_Find);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <XORList.hpp>
+#include <iterator>
 #include <list>
 
 static constexpr auto ITERATION_COUNTS = 100000;
@@ -26,4 +27,88 @@ static void BM_StdList_Resize(benchmark::State &state)
 }
 BENCHMARK(BM_StdList_Resize);
 
+// Benchmark for XORList growing from empty to state.range(0) elements
+static void BM_XORList_ResizeGrow(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        scc::XORList<int> list;
+        list.resize(state.range(0), 42);
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XORList_ResizeGrow)->Range(1 << 10, 1 << 20);
+
+// Benchmark for std::list growing from empty to state.range(0) elements
+static void BM_StdList_ResizeGrow(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::list<int> list;
+        list.resize(state.range(0), 42);
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdList_ResizeGrow)->Range(1 << 10, 1 << 20);
+
+// Benchmark for XORList shrinking from state.range(0) elements down to a tenth
+static void BM_XORList_ResizeShrink(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        list.resize(state.range(0), 42);
+        state.ResumeTiming();
+        list.resize(state.range(0) / 10);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XORList_ResizeShrink)->Range(1 << 10, 1 << 20);
+
+// Benchmark for std::list shrinking from state.range(0) elements down to a tenth
+static void BM_StdList_ResizeShrink(benchmark::State &state)
+{
+    std::list<int> list;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        list.resize(state.range(0), 42);
+        state.ResumeTiming();
+        list.resize(state.range(0) / 10);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdList_ResizeShrink)->Range(1 << 10, 1 << 20);
+
+// Benchmark for XORList inserting state.range(0) copies in the middle of a list
+static void BM_XORList_InsertCountMiddle(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        scc::XORList<int> list(2, 0);
+        state.ResumeTiming();
+        list.insert(++list.cbegin(), state.range(0), 42);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XORList_InsertCountMiddle)->Range(1 << 10, 1 << 20);
+
+// Benchmark for std::list inserting state.range(0) copies in the middle of a list
+static void BM_StdList_InsertCountMiddle(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> list(2, 0);
+        state.ResumeTiming();
+        list.insert(std::next(list.cbegin()), state.range(0), 42);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdList_InsertCountMiddle)->Range(1 << 10, 1 << 20);
+
 BENCHMARK_MAIN();
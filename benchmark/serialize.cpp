@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <XORListPool.hpp>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <vector>
+
+static constexpr auto ELEMENT_COUNTS = 10000000;
+
+static const scc::XORList<std::int64_t> &Source()
+{
+    static const scc::XORList<std::int64_t> list = []
+    {
+        scc::XORList<std::int64_t> result;
+        for (std::int64_t i = 0; i < ELEMENT_COUNTS; ++i)
+        {
+            result.push_back(i);
+        }
+        return result;
+    }();
+    return list;
+}
+
+// Benchmark for XORList write_to into a memory buffer
+static void BM_XORList_Save(benchmark::State &state)
+{
+    const auto &list = Source();
+    std::vector<unsigned char> buffer;
+    buffer.reserve(ELEMENT_COUNTS * sizeof(std::int64_t) + 64);
+    for (auto _ : state)
+    {
+        buffer.clear();
+        list.write_to(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * ELEMENT_COUNTS * sizeof(std::int64_t));
+}
+BENCHMARK(BM_XORList_Save)->Unit(benchmark::kMillisecond);
+
+// Benchmark for saving a std::list element by element into a memory buffer
+static void BM_StdList_Save(benchmark::State &state)
+{
+    std::list<std::int64_t> list(Source().cbegin(), Source().cend());
+    std::vector<unsigned char> buffer;
+    buffer.reserve(ELEMENT_COUNTS * sizeof(std::int64_t));
+    for (auto _ : state)
+    {
+        buffer.clear();
+        for (std::int64_t value : list)
+        {
+            const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * ELEMENT_COUNTS * sizeof(std::int64_t));
+}
+BENCHMARK(BM_StdList_Save)->Unit(benchmark::kMillisecond);
+
+// Benchmark for XORList read_from a memory buffer
+static void BM_XORList_Load(benchmark::State &state)
+{
+    std::vector<unsigned char> buffer;
+    Source().write_to(buffer);
+    for (auto _ : state)
+    {
+        scc::XORList<std::int64_t> list;
+        list.read_from(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetBytesProcessed(state.iterations() * ELEMENT_COUNTS * sizeof(std::int64_t));
+}
+BENCHMARK(BM_XORList_Load)->Unit(benchmark::kMillisecond);
+
+// Benchmark for XORList read_from with a pool allocator, so the whole chain is one allocation
+static void BM_XORList_LoadPool(benchmark::State &state)
+{
+    std::vector<unsigned char> buffer;
+    Source().write_to(buffer);
+    for (auto _ : state)
+    {
+        scc::XORList<std::int64_t, scc::CanThrow::NoThrow, scc::XORListPool<std::int64_t>> list;
+        list.read_from(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetBytesProcessed(state.iterations() * ELEMENT_COUNTS * sizeof(std::int64_t));
+}
+BENCHMARK(BM_XORList_LoadPool)->Unit(benchmark::kMillisecond);
+
+// Benchmark for loading a std::list element by element from a memory buffer
+static void BM_StdList_Load(benchmark::State &state)
+{
+    std::vector<unsigned char> buffer;
+    Source().write_to(buffer);
+    const unsigned char *elements = buffer.data() + (buffer.size() - ELEMENT_COUNTS * sizeof(std::int64_t));
+    for (auto _ : state)
+    {
+        std::list<std::int64_t> list;
+        for (size_t i = 0; i < ELEMENT_COUNTS; ++i)
+        {
+            std::int64_t value;
+            std::memcpy(&value, elements + i * sizeof(value), sizeof(value));
+            list.push_back(value);
+        }
+        benchmark::DoNotOptimize(list.back());
+    }
+    state.SetBytesProcessed(state.iterations() * ELEMENT_COUNTS * sizeof(std::int64_t));
+}
+BENCHMARK(BM_StdList_Load)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,11 @@
 #include <benchmark/benchmark.h>
 #include <XORList.hpp>
 #include <list>
+#include <random>
 
 static constexpr auto ITERATION_COUNTS = 100000;
-static constexpr auto SORT_COUNTS = 1000;
+static constexpr auto SORT_COUNTS = 100000;
+static constexpr auto SORT_MAX_COUNTS = 10000000;
 
 // Benchmark for XORList unique
 static void BM_XORList_Unique(benchmark::State &state)
@@ -35,11 +37,53 @@ static void BM_StdList_Unique(benchmark::State &state)
 }
 BENCHMARK(BM_StdList_Unique);
 
+// Overwrites every element with fresh pseudo-random values, so each iteration sorts unsorted data
+template <typename List>
+static void Scramble(List &list, std::mt19937 &rng)
+{
+    for (int &value : list)
+    {
+        value = static_cast<int>(rng());
+    }
+}
+
 // Benchmark for XORList sort
 static void BM_XORList_Sort(benchmark::State &state)
+{
+    std::mt19937 rng(1);
+    scc::XORList<int> list(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Scramble(list, rng);
+        state.ResumeTiming();
+        list.sort();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_XORList_Sort)->RangeMultiplier(10)->Range(SORT_COUNTS, SORT_MAX_COUNTS)->Unit(benchmark::kMillisecond);
+
+// Benchmark for std::list sort
+static void BM_StdList_Sort(benchmark::State &state)
+{
+    std::mt19937 rng(1);
+    std::list<int> list(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Scramble(list, rng);
+        state.ResumeTiming();
+        list.sort();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdList_Sort)->RangeMultiplier(10)->Range(SORT_COUNTS, SORT_MAX_COUNTS)->Unit(benchmark::kMillisecond);
+
+// Benchmark for XORList sort of already sorted input
+static void BM_XORList_SortPresorted(benchmark::State &state)
 {
     scc::XORList<int> list;
-    for (int i = SORT_COUNTS; i > 0; --i)
+    for (int i = 0; i < state.range(0); ++i)
     {
         list.push_back(i);
     }
@@ -48,13 +92,13 @@ static void BM_XORList_Sort(benchmark::State &state)
         list.sort();
     }
 }
-BENCHMARK(BM_XORList_Sort);
+BENCHMARK(BM_XORList_SortPresorted)->RangeMultiplier(10)->Range(SORT_COUNTS, SORT_MAX_COUNTS)->Unit(benchmark::kMillisecond);
 
-// Benchmark for std::list sort
-static void BM_StdList_Sort(benchmark::State &state)
+// Benchmark for std::list sort of already sorted input
+static void BM_StdList_SortPresorted(benchmark::State &state)
 {
     std::list<int> list;
-    for (int i = SORT_COUNTS; i > 0; --i)
+    for (int i = 0; i < state.range(0); ++i)
     {
         list.push_back(i);
     }
@@ -63,6 +107,6 @@ static void BM_StdList_Sort(benchmark::State &state)
         list.sort();
     }
 }
-BENCHMARK(BM_StdList_Sort);
+BENCHMARK(BM_StdList_SortPresorted)->RangeMultiplier(10)->Range(SORT_COUNTS, SORT_MAX_COUNTS)->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN();
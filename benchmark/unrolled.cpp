@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <XORList.hpp>
+#include <UnrolledXORList.hpp>
+#include <deque>
+#include <list>
+#include <numeric>
+
+static constexpr auto ITERATION_COUNTS = 1000000;
+
+// Benchmark for XORList push_back
+static void BM_XORList_UnrolledPushBack(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        scc::UnrolledXORList<int> list;
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+BENCHMARK(BM_XORList_UnrolledPushBack);
+
+// Benchmark for std::deque push_back
+static void BM_StdList_DequePushBack(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::deque<int> list;
+        for (int i = 0; i < ITERATION_COUNTS; ++i)
+        {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+}
+BENCHMARK(BM_StdList_DequePushBack);
+
+// Benchmark for XORList traversal
+static void BM_XORList_Traverse(benchmark::State &state)
+{
+    scc::XORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0L));
+    }
+}
+BENCHMARK(BM_XORList_Traverse);
+
+// Benchmark for std::list traversal
+static void BM_StdList_Traverse(benchmark::State &state)
+{
+    std::list<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0L));
+    }
+}
+BENCHMARK(BM_StdList_Traverse);
+
+// Benchmark for UnrolledXORList traversal
+static void BM_XORList_UnrolledTraverse(benchmark::State &state)
+{
+    scc::UnrolledXORList<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0L));
+    }
+    state.counters["bytes_per_element"] = static_cast<double>((ITERATION_COUNTS + list.node_capacity() - 1) / list.node_capacity() * (2 * sizeof(void *) + sizeof(int) * list.node_capacity())) / ITERATION_COUNTS;
+}
+BENCHMARK(BM_XORList_UnrolledTraverse);
+
+// Benchmark for std::deque traversal
+static void BM_StdList_DequeTraverse(benchmark::State &state)
+{
+    std::deque<int> list;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0L));
+    }
+}
+BENCHMARK(BM_StdList_DequeTraverse);
+
+// Benchmark for UnrolledXORList splice of a whole list
+static void BM_XORList_UnrolledSplice(benchmark::State &state)
+{
+    scc::UnrolledXORList<int> list, other;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        other.push_back(1);
+        list.splice(list.cbegin(), other);
+    }
+}
+BENCHMARK(BM_XORList_UnrolledSplice);
+
+// Benchmark for std::list splice of a whole list
+static void BM_StdList_Splice(benchmark::State &state)
+{
+    std::list<int> list, other;
+    for (int i = 0; i < ITERATION_COUNTS; ++i)
+    {
+        list.push_back(i);
+    }
+    for (auto _ : state)
+    {
+        other.push_back(1);
+        list.splice(list.begin(), other);
+    }
+}
+BENCHMARK(BM_StdList_Splice);
+
+BENCHMARK_MAIN();
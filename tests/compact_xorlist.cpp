@@ -0,0 +1,170 @@
+#include <CompactXORList.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace scc
+{
+    template <typename List, typename T>
+    static void ExpectSameElements(const List &list, const std::list<T> &expected)
+    {
+        ASSERT_EQ(list.size(), expected.size());
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+
+        // Walk backwards from the end as well, so both directions of the XOR links are checked.
+        EXPECT_TRUE(std::equal(list.crbegin(), list.crend(), expected.crbegin()));
+    }
+
+    TEST(CompactXORListTest, NodeIsHalfAnXORListNode)
+    {
+        EXPECT_EQ(CompactXORList<int>::node_size, 8u);
+        EXPECT_EQ(CompactXORList<std::uint32_t>::node_size, 2 * sizeof(std::uint32_t));
+    }
+
+    TEST(CompactXORListTest, PushPopBothEnds)
+    {
+        CompactXORList<int> list;
+        std::list<int> expected;
+        for (int i = 0; i < 10000; ++i)
+        {
+            if (i % 3 == 0)
+            {
+                list.push_front(i);
+                expected.push_front(i);
+            }
+            else
+            {
+                list.push_back(i);
+                expected.push_back(i);
+            }
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.pop_front();
+            expected.pop_front();
+            list.pop_back();
+            expected.pop_back();
+        }
+        ExpectSameElements(list, expected);
+        EXPECT_EQ(list.front(), expected.front());
+        EXPECT_EQ(list.back(), expected.back());
+    }
+
+    TEST(CompactXORListTest, RandomInsertErase)
+    {
+        CompactXORList<int> list;
+        std::list<int> expected;
+        std::mt19937 rng(7);
+        for (int i = 0; i < 2000; ++i)
+        {
+            size_t position = expected.empty() ? 0 : rng() % (expected.size() + 1);
+            if (!expected.empty() && rng() % 3 == 0)
+            {
+                position = std::min(position, expected.size() - 1);
+                auto it = list.erase(std::next(list.cbegin(), position));
+                auto expected_it = expected.erase(std::next(expected.cbegin(), position));
+                EXPECT_EQ(it == list.end(), expected_it == expected.end());
+                if (expected_it != expected.end())
+                {
+                    EXPECT_EQ(*it, *expected_it);
+                }
+            }
+            else
+            {
+                auto it = list.insert(std::next(list.cbegin(), position), i);
+                expected.insert(std::next(expected.cbegin(), position), i);
+                EXPECT_EQ(*it, i);
+            }
+        }
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(CompactXORListTest, EraseRange)
+    {
+        CompactXORList<int> list{0, 1, 2, 3, 4, 5};
+        auto it = list.erase(std::next(list.cbegin()), std::next(list.cbegin(), 4));
+        EXPECT_EQ(*it, 4);
+        ExpectSameElements(list, std::list<int>{0, 4, 5});
+    }
+
+    TEST(CompactXORListTest, FreedSlotsAreReused)
+    {
+        CompactXORList<int> list(5000, 1);
+        size_t capacity = list.capacity();
+        EXPECT_GE(capacity, 5000u);
+        list.clear();
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.push_back(i);
+        }
+        EXPECT_EQ(list.capacity(), capacity);
+    }
+
+    TEST(CompactXORListTest, SmallListsStaySmall)
+    {
+        CompactXORList<int> list{1};
+        EXPECT_EQ(list.capacity(), 15u); // slot 0 is the null link
+
+        // Growth doubles through the small chunks and then continues in 4096-slot ones, across every boundary.
+        std::list<int> expected{1};
+        for (int i = 0; i < 20000; ++i)
+        {
+            list.push_back(i);
+            expected.push_back(i);
+            EXPECT_LT(list.capacity(), 2 * list.size() + 4096);
+        }
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(CompactXORListTest, ReferencesSurviveGrowth)
+    {
+        CompactXORList<std::string> list;
+        std::string &first = list.emplace_back("first");
+        for (int i = 0; i < 20000; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+        EXPECT_EQ(first, "first");
+        EXPECT_EQ(&first, &list.front());
+    }
+
+    TEST(CompactXORListTest, CopyMoveAndCompare)
+    {
+        CompactXORList<std::string> list{"a", "b", "c"};
+        CompactXORList<std::string> copy(list);
+        EXPECT_TRUE(copy == list);
+
+        CompactXORList<std::string> moved(std::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_TRUE(moved == list);
+
+        copy = moved;
+        copy.push_back("d");
+        EXPECT_TRUE(copy != moved);
+        moved = std::move(copy);
+        ExpectSameElements(moved, std::list<std::string>{"a", "b", "c", "d"});
+    }
+
+    TEST(CompactXORListTest, Reverse)
+    {
+        CompactXORList<int> list{1, 2, 3, 4};
+        list.reverse();
+        ExpectSameElements(list, std::list<int>{4, 3, 2, 1});
+        list.push_back(0);
+        list.push_front(5);
+        ExpectSameElements(list, std::list<int>{5, 4, 3, 2, 1, 0});
+    }
+
+    TEST(CompactXORListTest, ThrowOnEmpty)
+    {
+        CompactXORList<int, CanThrow::Throw> list;
+        EXPECT_THROW(list.pop_back(), std::runtime_error);
+        EXPECT_THROW(list.back(), std::runtime_error);
+
+        CompactXORList<int> quiet;
+        quiet.pop_front();
+        EXPECT_TRUE(quiet.empty());
+    }
+}
@@ -0,0 +1,195 @@
+#if __has_include(<sys/mman.h>)
+
+#include <MappedXORList.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <list>
+#include <random>
+#include <string>
+
+namespace scc
+{
+    // Removes its file on destruction so every test starts from a missing file.
+    struct TempPath
+    {
+        std::string path;
+
+        explicit TempPath(const std::string &name)
+            : path((std::filesystem::temp_directory_path() / ("xorlist_" + name + "_" + std::to_string(::getpid()))).string())
+        {
+            std::remove(path.c_str());
+        }
+
+        ~TempPath()
+        {
+            std::remove(path.c_str());
+        }
+    };
+
+    template <typename List, typename T>
+    static void ExpectSameElements(const List &list, const std::list<T> &expected)
+    {
+        ASSERT_EQ(list.size(), expected.size());
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+
+        // Walk backwards from the end as well, so both directions of the XOR links are checked.
+        auto it = list.cend();
+        for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+        {
+            --it;
+            EXPECT_EQ(*it, *rit);
+        }
+        EXPECT_TRUE(it == list.cbegin());
+    }
+
+    TEST(MappedXORListTest, PushPopBothEnds)
+    {
+        TempPath file("pushpop");
+        MappedXORList<int> list(file.path);
+        std::list<int> expected;
+        EXPECT_TRUE(list.empty());
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+            list.push_front(-i);
+            expected.push_back(i);
+            expected.push_front(-i);
+        }
+        list.pop_back();
+        list.pop_front();
+        expected.pop_back();
+        expected.pop_front();
+        ExpectSameElements(list, expected);
+        EXPECT_EQ(list.front(), expected.front());
+        EXPECT_EQ(list.back(), expected.back());
+    }
+
+    TEST(MappedXORListTest, ReopenKeepsContents)
+    {
+        TempPath file("reopen");
+        std::list<double> expected;
+        {
+            MappedXORList<double> list(file.path);
+            for (int i = 0; i < 50000; ++i) // enough to grow and remap the file several times
+            {
+                list.push_back(i * 0.5);
+                expected.push_back(i * 0.5);
+            }
+            list.erase(++list.cbegin());
+            expected.erase(++expected.cbegin());
+            list.flush();
+        }
+
+        MappedXORList<double> reopened(file.path);
+        ExpectSameElements(reopened, expected);
+        reopened.push_front(-1.0);
+        expected.push_front(-1.0);
+        ExpectSameElements(reopened, expected);
+    }
+
+    TEST(MappedXORListTest, IteratorsSurviveGrowth)
+    {
+        TempPath file("growth");
+        MappedXORList<int> list(file.path);
+        list.push_back(1);
+        list.push_back(2);
+        auto second = ++list.begin();
+        size_t initial = list.file_size();
+        while (list.file_size() == initial)
+        {
+            list.push_back(3);
+        }
+        EXPECT_EQ(*second, 2);
+        EXPECT_EQ(*--second, 1);
+    }
+
+    TEST(MappedXORListTest, PushOwnElementAcrossGrowth)
+    {
+        TempPath file("self");
+        MappedXORList<long> list(file.path);
+        std::list<long> expected;
+        list.push_back(7);
+        list.push_front(-7);
+        expected = {-7, 7};
+        size_t initial = list.file_size();
+        while (list.file_size() == initial)
+        {
+            // Each argument refers into the mapping that the push may remap.
+            list.push_back(list.front());
+            list.push_front(list.back());
+            list.insert(++list.cbegin(), *--list.cend());
+            expected.push_back(expected.front());
+            expected.push_front(expected.back());
+            expected.insert(++expected.cbegin(), *--expected.cend());
+        }
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(MappedXORListTest, RandomInsertEraseReusesNodes)
+    {
+        TempPath file("random");
+        MappedXORList<long> list(file.path);
+        std::list<long> expected;
+        std::mt19937 rng(3);
+        for (long i = 0; i < 3000; ++i)
+        {
+            size_t position = expected.empty() ? 0 : rng() % expected.size();
+            if (!expected.empty() && rng() % 2 == 0)
+            {
+                list.erase(std::next(list.cbegin(), position));
+                expected.erase(std::next(expected.cbegin(), position));
+            }
+            else
+            {
+                auto it = list.insert(std::next(list.cbegin(), position), i);
+                expected.insert(std::next(expected.cbegin(), position), i);
+                EXPECT_EQ(*it, i);
+            }
+        }
+        ExpectSameElements(list, expected);
+
+        // Erased nodes are recycled, so refilling to the same size keeps the file as it is.
+        size_t file_size = list.file_size();
+        list.clear();
+        for (long i = 0; i < 3000; ++i)
+        {
+            list.push_back(i);
+        }
+        EXPECT_EQ(list.file_size(), file_size);
+    }
+
+    TEST(MappedXORListTest, RejectsOtherElementType)
+    {
+        TempPath file("mismatch");
+        {
+            MappedXORList<char> list(file.path);
+            list.push_back('x');
+        }
+        EXPECT_THROW(MappedXORList<long double>{file.path}, std::runtime_error);
+    }
+
+    TEST(MappedXORListTest, OpenFailureThrows)
+    {
+        EXPECT_THROW(MappedXORList<int>("/nonexistent-directory/list"), std::system_error);
+    }
+
+    TEST(MappedXORListTest, ThrowOnEmpty)
+    {
+        TempPath file("throw");
+        MappedXORList<int, CanThrow::Throw> list(file.path);
+        EXPECT_THROW(list.pop_back(), std::runtime_error);
+        EXPECT_THROW(list.front(), std::runtime_error);
+    }
+
+    TEST(MappedXORListTest, Move)
+    {
+        TempPath file("move");
+        MappedXORList<int> list(file.path);
+        list.push_back(7);
+        MappedXORList<int> moved(std::move(list));
+        EXPECT_EQ(moved.front(), 7);
+    }
+}
+
+#endif
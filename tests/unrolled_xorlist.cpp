@@ -0,0 +1,301 @@
+#include <UnrolledXORList.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace scc
+{
+    template <typename List, typename T>
+    static void ExpectSameElements(const List &list, const std::list<T> &expected)
+    {
+        ASSERT_EQ(list.size(), expected.size());
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+
+        // Walk backwards from the end as well, so both directions of the XOR spine are checked.
+        auto it = list.cend();
+        for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+        {
+            --it;
+            EXPECT_EQ(*it, *rit);
+        }
+        EXPECT_TRUE(it == list.cbegin());
+    }
+
+    TEST(UnrolledXORListTest, PushPopBothEnds)
+    {
+        UnrolledXORList<int, 4> list;
+        std::list<int> expected;
+        for (int i = 0; i < 20; ++i)
+        {
+            list.push_back(i);
+            list.push_front(-i);
+            expected.push_back(i);
+            expected.push_front(-i);
+        }
+        ExpectSameElements(list, expected);
+        EXPECT_EQ(list.front(), -19);
+        EXPECT_EQ(list.back(), 19);
+
+        for (int i = 0; i < 15; ++i)
+        {
+            list.pop_back();
+            list.pop_front();
+            expected.pop_back();
+            expected.pop_front();
+        }
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(UnrolledXORListTest, InsertSplitsFullNodes)
+    {
+        UnrolledXORList<int, 4> list = {1, 2, 3, 4};
+        auto it = list.insert(++++list.cbegin(), 10);
+        EXPECT_EQ(*it, 10);
+        ExpectSameElements(list, std::list<int>{1, 2, 10, 3, 4});
+
+        it = list.insert(list.cend(), 20);
+        EXPECT_EQ(*it, 20);
+        it = list.insert(list.cbegin(), 0);
+        EXPECT_EQ(*it, 0);
+        ExpectSameElements(list, std::list<int>{0, 1, 2, 10, 3, 4, 20});
+    }
+
+    TEST(UnrolledXORListTest, EraseReturnsNextElement)
+    {
+        UnrolledXORList<int, 4> list = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto it = list.erase(++list.cbegin());
+        EXPECT_EQ(*it, 3);
+        it = list.erase(it);
+        EXPECT_EQ(*it, 4);
+
+        while (it != list.end())
+        {
+            it = list.erase(it);
+        }
+        ExpectSameElements(list, std::list<int>{1});
+        EXPECT_EQ(list.erase(list.cend()), list.end());
+    }
+
+    TEST(UnrolledXORListTest, Reverse)
+    {
+        UnrolledXORList<int, 4> list;
+        std::list<int> expected;
+        for (int i = 0; i < 10; ++i)
+        {
+            list.push_back(i);
+            expected.push_back(i);
+        }
+        list.reverse();
+        expected.reverse();
+        ExpectSameElements(list, expected);
+
+        // Operations after the reverse must honour the new orientation.
+        list.push_back(100);
+        list.push_front(-100);
+        list.insert(++list.cbegin(), 50);
+        expected.push_back(100);
+        expected.push_front(-100);
+        expected.insert(++expected.begin(), 50);
+        ExpectSameElements(list, expected);
+
+        list.reverse();
+        expected.reverse();
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(UnrolledXORListTest, Splice)
+    {
+        UnrolledXORList<int, 4> list = {1, 2, 3, 4, 5, 6};
+        UnrolledXORList<int, 4> other = {10, 11, 12, 13, 14};
+        std::list<int> expected = {1, 2, 3, 4, 5, 6};
+        std::list<int> expected_other = {10, 11, 12, 13, 14};
+
+        // Splicing into the middle of a node splits it.
+        list.splice(++++list.cbegin(), other);
+        expected.splice(++++expected.begin(), expected_other);
+        ExpectSameElements(list, expected);
+        EXPECT_TRUE(other.empty());
+
+        UnrolledXORList<int, 4> reversed = {20, 21, 22, 23, 24, 25};
+        reversed.reverse();
+        list.splice(list.cend(), reversed);
+        expected.insert(expected.end(), {25, 24, 23, 22, 21, 20});
+        ExpectSameElements(list, expected);
+
+        UnrolledXORList<int, 4> front = {-2, -1};
+        list.splice(list.cbegin(), front);
+        expected.insert(expected.begin(), {-2, -1});
+        ExpectSameElements(list, expected);
+    }
+
+    TEST(UnrolledXORListTest, CopyMoveAndCompare)
+    {
+        UnrolledXORList<std::string, 3> list = {"a", "b", "c", "d", "e"};
+        UnrolledXORList<std::string, 3> copied(list);
+        EXPECT_EQ(copied, list);
+
+        UnrolledXORList<std::string, 3> moved(std::move(list));
+        EXPECT_EQ(moved, copied);
+        EXPECT_TRUE(list.empty());
+
+        copied.pop_back();
+        EXPECT_NE(copied, moved);
+        copied = moved;
+        EXPECT_EQ(copied, moved);
+    }
+
+    TEST(UnrolledXORListTest, MoveOnlyElements)
+    {
+        UnrolledXORList<std::unique_ptr<int>, 2> list;
+        list.push_back(std::make_unique<int>(2));
+        list.push_front(std::make_unique<int>(1));
+        list.emplace(++list.cbegin(), std::make_unique<int>(5));
+        list.emplace_back(new int(3));
+
+        int expected[] = {1, 5, 2, 3};
+        size_t i = 0;
+        for (const auto &value : list)
+        {
+            EXPECT_EQ(*value, expected[i++]);
+        }
+    }
+
+    // Copies throw once `copies_left` runs out, and the move may throw too, so the list falls back on copying.
+    struct Fragile
+    {
+        static inline int live = 0;
+        static inline int copies_left = -1; // negative: unlimited
+        int value;
+
+        Fragile(int v) : value(v) { ++live; }
+        Fragile(const Fragile &other) : value(other.value)
+        {
+            if (copies_left == 0)
+            {
+                throw std::runtime_error("copy failed");
+            }
+            if (copies_left > 0)
+            {
+                --copies_left;
+            }
+            ++live;
+        }
+        Fragile(Fragile &&other) noexcept(false) : value(other.value) { ++live; }
+        Fragile &operator=(const Fragile &) = default;
+        Fragile &operator=(Fragile &&) = default;
+        ~Fragile() { --live; }
+
+        bool operator==(const Fragile &other) const { return value == other.value; }
+    };
+
+    TEST(UnrolledXORListTest, ThrowingCopyLeavesNodesIntact)
+    {
+        {
+            UnrolledXORList<Fragile, 8, CanThrow::Throw> list;
+            std::list<Fragile> expected;
+            for (int i = 0; i < 9; ++i)
+            {
+                list.push_back(Fragile(i));
+                expected.push_back(Fragile(i));
+            }
+
+            // Inserting into the full first node splits it; the split throws halfway through its copies.
+            Fragile::copies_left = 2;
+            EXPECT_THROW(list.insert(++list.cbegin(), Fragile(42)), std::runtime_error);
+            Fragile::copies_left = -1;
+            ExpectSameElements(list, expected);
+
+            // The fifth erase lets the second node fold into the first; its copy throws, so the fold is skipped.
+            for (int i = 0; i < 5; ++i)
+            {
+                Fragile::copies_left = i == 4 ? 0 : -1;
+                list.erase(list.cbegin());
+                expected.pop_front();
+            }
+            Fragile::copies_left = -1;
+            ExpectSameElements(list, expected);
+            list.push_back(Fragile(9));
+            expected.push_back(Fragile(9));
+            ExpectSameElements(list, expected);
+        }
+        EXPECT_EQ(Fragile::live, 0);
+    }
+
+    TEST(UnrolledXORListTest, ThrowsOnEmpty)
+    {
+        UnrolledXORList<int, 4, CanThrow::Throw> list;
+        EXPECT_THROW(list.front(), std::runtime_error);
+        EXPECT_THROW(list.back(), std::runtime_error);
+        EXPECT_THROW(list.pop_back(), std::runtime_error);
+        EXPECT_THROW(list.pop_front(), std::runtime_error);
+
+        UnrolledXORList<int, 4> quiet;
+        EXPECT_NO_THROW(quiet.pop_back());
+        EXPECT_NO_THROW(quiet.pop_front());
+    }
+
+    TEST(UnrolledXORListTest, RandomOperationsMatchStdList)
+    {
+        std::mt19937 rng(42);
+        UnrolledXORList<int, 5> list;
+        std::list<int> expected;
+
+        for (int step = 0; step < 5000; ++step)
+        {
+            size_t position = expected.empty() ? 0 : rng() % (expected.size() + 1);
+            auto it = list.cbegin();
+            auto expected_it = expected.begin();
+            for (size_t i = 0; i < position; ++i)
+            {
+                ++it;
+                ++expected_it;
+            }
+
+            switch (rng() % 6)
+            {
+            case 0:
+                list.push_back(step);
+                expected.push_back(step);
+                break;
+            case 1:
+                list.push_front(step);
+                expected.push_front(step);
+                break;
+            case 2:
+                EXPECT_EQ(*list.insert(it, step), step);
+                expected.insert(expected_it, step);
+                break;
+            case 3:
+                if (expected_it != expected.end())
+                {
+                    auto next = list.erase(it);
+                    expected_it = expected.erase(expected_it);
+                    if (expected_it != expected.end())
+                    {
+                        EXPECT_EQ(*next, *expected_it);
+                    }
+                }
+                break;
+            case 4:
+                if (!expected.empty())
+                {
+                    list.pop_front();
+                    expected.pop_front();
+                }
+                break;
+            case 5:
+                if (rng() % 20 == 0)
+                {
+                    list.reverse();
+                    expected.reverse();
+                }
+                break;
+            }
+        }
+        ExpectSameElements(list, expected);
+    }
+} // namespace scc
@@ -1,6 +1,17 @@
 #include <XORList.hpp>
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace scc
 {
@@ -245,6 +256,113 @@ namespace scc
         EXPECT_EQ(list.back(), 3);
     }
 
+    template <typename List>
+    static void ExpectConsistentLinks(const List &list)
+    {
+        size_t forward = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it)
+        {
+            ++forward;
+        }
+        EXPECT_EQ(forward, list.size());
+
+        size_t backward = 0;
+        for (auto it = list.crbegin(); it != list.crend(); ++it)
+        {
+            ++backward;
+        }
+        EXPECT_EQ(backward, list.size());
+    }
+
+    TEST(XORListTest, SortLargeRandom)
+    {
+        std::mt19937 rng(7);
+        std::vector<int> values(100000);
+        for (int &value : values)
+        {
+            value = static_cast<int>(rng() % 1000);
+        }
+
+        XORList<int> list(values.begin(), values.end());
+        list.sort();
+        std::sort(values.begin(), values.end());
+
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), values.cbegin(), values.cend()));
+        ExpectConsistentLinks(list);
+        EXPECT_EQ(list.back(), values.back());
+    }
+
+    TEST(XORListTest, SortIsStable)
+    {
+        std::mt19937 rng(11);
+        std::vector<std::pair<int, int>> values;
+        for (int i = 0; i < 5000; ++i)
+        {
+            values.emplace_back(static_cast<int>(rng() % 50), i);
+        }
+
+        XORList<std::pair<int, int>> list(values.begin(), values.end());
+        auto byKey = [](const std::pair<int, int> &a, const std::pair<int, int> &b)
+        { return a.first < b.first; };
+        list.sort(byKey);
+        std::stable_sort(values.begin(), values.end(), byKey);
+
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), values.cbegin(), values.cend()));
+    }
+
+    TEST(XORListTest, SortWithComparatorAndPresortedRuns)
+    {
+        XORList<int> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i % 100);
+        }
+        list.reverse();
+        list.sort(std::greater<int>());
+
+        int previous = std::numeric_limits<int>::max();
+        for (int value : list)
+        {
+            EXPECT_LE(value, previous);
+            previous = value;
+        }
+        EXPECT_EQ(list.front(), 99);
+        EXPECT_EQ(list.back(), 0);
+        ExpectConsistentLinks(list);
+
+        XORList<int> descending = {5, 4, 3, 2, 1};
+        descending.sort();
+        EXPECT_EQ(descending, (XORList<int>{1, 2, 3, 4, 5}));
+        ExpectConsistentLinks(descending);
+    }
+
+    TEST(XORListTest, SortKeepsNodesWhenComparatorThrows)
+    {
+        XORList<int, CanThrow::Throw> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back((i * 7919) % 1000);
+        }
+
+        int budget = 5000;
+        EXPECT_THROW(list.sort([&budget](int a, int b)
+                               {
+                                   if (--budget == 0)
+                                   {
+                                       throw std::runtime_error("comparison budget exhausted");
+                                   }
+                                   return a < b; }),
+                     std::runtime_error);
+
+        EXPECT_EQ(list.size(), 1000);
+        ExpectConsistentLinks(list);
+        EXPECT_EQ(std::accumulate(list.cbegin(), list.cend(), 0), 999 * 1000 / 2);
+
+        list.sort();
+        EXPECT_EQ(list.front(), 0);
+        EXPECT_EQ(list.back(), 999);
+    }
+
     TEST(XORListTest, Clear)
     {
         XORList<int> list;
@@ -382,6 +500,84 @@ namespace scc
         EXPECT_EQ(ref.c, "test");
     }
 
+    TEST(XORListTest, EmplaceConstructsInPlace)
+    {
+        struct Counted
+        {
+            int value;
+            int *copies;
+            int *moves;
+
+            Counted(int v, int *c, int *m) : value(v), copies(c), moves(m) {}
+            Counted(const Counted &other) : value(other.value), copies(other.copies), moves(other.moves) { ++*copies; }
+            Counted(Counted &&other) noexcept : value(other.value), copies(other.copies), moves(other.moves) { ++*moves; }
+        };
+
+        int copies = 0;
+        int moves = 0;
+
+        XORList<Counted> list;
+        list.emplace_back(2, &copies, &moves);
+        list.emplace_front(1, &copies, &moves);
+        list.emplace(++list.cbegin(), 5, &copies, &moves);
+        EXPECT_EQ(copies, 0);
+        EXPECT_EQ(moves, 0);
+
+        list.push_back(Counted(3, &copies, &moves));
+        EXPECT_EQ(copies, 0);
+        EXPECT_EQ(moves, 1);
+
+        auto it = list.begin();
+        EXPECT_EQ((it++)->value, 1);
+        EXPECT_EQ((it++)->value, 5);
+        EXPECT_EQ((it++)->value, 2);
+        EXPECT_EQ((it++)->value, 3);
+    }
+
+    TEST(XORListTest, MoveOnlyElements)
+    {
+        XORList<std::unique_ptr<int>> list;
+        list.push_back(std::make_unique<int>(2));
+        list.push_front(std::make_unique<int>(1));
+        list.emplace_back(new int(4));
+        list.emplace(--list.cend(), std::make_unique<int>(3));
+
+        EXPECT_EQ(list.size(), 4);
+        int expected = 1;
+        for (const auto &value : list)
+        {
+            EXPECT_EQ(*value, expected++);
+        }
+
+        XORList<std::unique_ptr<int>> moved(std::move(list));
+        EXPECT_EQ(*moved.back(), 4);
+        moved.pop_back();
+        moved.erase(moved.cbegin());
+        EXPECT_EQ(*moved.front(), 2);
+    }
+
+    TEST(XORListTest, ThrowingConstructorLeavesListIntact)
+    {
+        struct Fragile
+        {
+            int value;
+            explicit Fragile(int v) : value(v)
+            {
+                if (v < 0)
+                {
+                    throw std::invalid_argument("negative");
+                }
+            }
+        };
+
+        XORList<Fragile, CanThrow::Throw> list;
+        list.emplace_back(1);
+        EXPECT_THROW(list.emplace_back(-1), std::invalid_argument);
+        EXPECT_THROW(list.emplace_front(-1), std::invalid_argument);
+        EXPECT_EQ(list.size(), 1);
+        EXPECT_EQ(list.front().value, 1);
+    }
+
     TEST(XORListTest, Splice)
     {
         XORList<int> list1;
@@ -431,17 +627,79 @@ namespace scc
         auto it = list1.begin();
         EXPECT_EQ(*it, 1);
         ++it;
-        EXPECT_EQ(*it, 3);
-        ++it;
-        EXPECT_EQ(*it, 5);
-        ++it;
         EXPECT_EQ(*it, 2);
         ++it;
+        EXPECT_EQ(*it, 3);
+        ++it;
         EXPECT_EQ(*it, 4);
         ++it;
+        EXPECT_EQ(*it, 5);
+        ++it;
         EXPECT_EQ(*it, 6);
     }
 
+    TEST(XORListTest, MergeIsStableAndUsesComparator)
+    {
+        using Item = std::pair<int, char>;
+        auto byKey = [](const Item &a, const Item &b)
+        { return a.first > b.first; };
+
+        XORList<Item, CanThrow::Throw> list1 = {{9, 'a'}, {5, 'a'}, {5, 'b'}, {1, 'a'}};
+        XORList<Item, CanThrow::Throw> list2 = {{10, 'x'}, {5, 'x'}, {0, 'x'}};
+
+        list1.merge(list2, byKey);
+
+        XORList<Item, CanThrow::Throw> expected = {{10, 'x'}, {9, 'a'}, {5, 'a'}, {5, 'b'}, {5, 'x'}, {1, 'a'}, {0, 'x'}};
+        EXPECT_EQ(list1, expected);
+        EXPECT_TRUE(list2.empty());
+        ExpectConsistentLinks(list1);
+    }
+
+    TEST(XORListTest, MergeEdgeCases)
+    {
+        XORList<int> list;
+        list.merge(XORList<int>{1, 2});
+        EXPECT_EQ(list, (XORList<int>{1, 2}));
+
+        list.merge(list);
+        EXPECT_EQ(list.size(), 2);
+
+        XORList<int> empty;
+        list.merge(empty);
+        EXPECT_EQ(list, (XORList<int>{1, 2}));
+
+        // Every incoming element sorts after the existing ones, and then before them.
+        list.merge(XORList<int>{3, 4});
+        list.merge(XORList<int>{-1, 0});
+        EXPECT_EQ(list, (XORList<int>{-1, 0, 1, 2, 3, 4}));
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, MergeLargeInterleaved)
+    {
+        std::mt19937 rng(3);
+        std::vector<int> a(20000), b(30000);
+        for (int &value : a)
+        {
+            value = static_cast<int>(rng() % 100000);
+        }
+        for (int &value : b)
+        {
+            value = static_cast<int>(rng() % 100000);
+        }
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+
+        XORList<int> list1(a.begin(), a.end());
+        XORList<int> list2(b.begin(), b.end());
+        list1.merge(list2);
+
+        std::vector<int> expected;
+        std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        EXPECT_TRUE(std::equal(list1.cbegin(), list1.cend(), expected.cbegin(), expected.cend()));
+        ExpectConsistentLinks(list1);
+    }
+
     TEST(XORListTest, GetAllocator)
     {
         XORList<int> list;
@@ -602,6 +860,52 @@ namespace scc
         EXPECT_EQ(list.back(), 2);
     }
 
+    TEST(XORListTest, ResizeInBulk)
+    {
+        XORList<int> list(3, 7);
+        EXPECT_EQ(list, (XORList<int>{7, 7, 7}));
+
+        list.resize(1000);
+        EXPECT_EQ(list.size(), 1000);
+        EXPECT_EQ(list.back(), 0);
+        ExpectConsistentLinks(list);
+
+        // Shrinking near the tail and near the head.
+        list.resize(998);
+        EXPECT_EQ(list.size(), 998);
+        list.resize(2);
+        EXPECT_EQ(list, (XORList<int>{7, 7}));
+        ExpectConsistentLinks(list);
+
+        list.resize(0);
+        EXPECT_TRUE(list.empty());
+        list.resize(2, 5);
+        EXPECT_EQ(list, (XORList<int>{5, 5}));
+        ExpectConsistentLinks(list);
+
+        XORList<std::unique_ptr<int>> pointers(4);
+        EXPECT_EQ(pointers.size(), 4);
+        pointers.resize(6);
+        EXPECT_EQ(pointers.back(), nullptr);
+    }
+
+    TEST(XORListTest, InsertCountReturnsFirstInserted)
+    {
+        XORList<int> list = {1, 2};
+
+        auto it = list.insert(++list.cbegin(), 3, 9);
+        EXPECT_EQ(*it, 9);
+        EXPECT_EQ(*--it, 1);
+        EXPECT_EQ(list, (XORList<int>{1, 9, 9, 9, 2}));
+
+        it = list.insert(list.cend(), 0, 4);
+        EXPECT_EQ(it, list.end());
+        it = list.insert(list.cbegin(), 1, 0);
+        EXPECT_EQ(it, list.begin());
+        EXPECT_EQ(list.size(), 6);
+        ExpectConsistentLinks(list);
+    }
+
     TEST(XORListTest, Swap)
     {
         XORList<int> list1;
@@ -1104,6 +1408,47 @@ namespace scc
         EXPECT_EQ(copied_list.back(), 3);
     }
 
+    TEST(XORListTest, CopyAssignmentReusesNodes)
+    {
+        XORList<std::string> source = {"a", "b", "c", "d"};
+        XORList<std::string> target = {"w", "x", "y", "z"};
+
+        std::vector<const std::string *> addresses;
+        for (const auto &value : target)
+        {
+            addresses.push_back(&value);
+        }
+
+        target = source;
+        EXPECT_EQ(target, source);
+        size_t i = 0;
+        for (const auto &value : target)
+        {
+            EXPECT_EQ(&value, addresses[i++]);
+        }
+
+        // Longer and shorter sources extend or trim the reused chain.
+        source.push_back("e");
+        source.push_back("f");
+        target = source;
+        EXPECT_EQ(target, source);
+        EXPECT_EQ(&target.front(), addresses[0]);
+        ExpectConsistentLinks(target);
+
+        source.resize(1);
+        target = source;
+        EXPECT_EQ(target, (XORList<std::string>{"a"}));
+        EXPECT_EQ(&target.front(), addresses[0]);
+        ExpectConsistentLinks(target);
+
+        target = {"p", "q"};
+        EXPECT_EQ(target, (XORList<std::string>{"p", "q"}));
+        EXPECT_EQ(&target.front(), addresses[0]);
+        target.assign(source.cbegin(), source.cend());
+        EXPECT_EQ(target, source);
+        ExpectConsistentLinks(target);
+    }
+
     // Splice Variants
 
     TEST(XORListTest, SpliceSingleElement)
@@ -1157,6 +1502,1019 @@ namespace scc
         EXPECT_EQ(*it, 2);
     }
 
+    TEST(XORListTest, SpliceIteratorWholeList)
+    {
+        XORList<int> list1 = {1, 2, 5};
+        XORList<int> list2 = {3, 4};
+
+        auto pos = list1.splice(--list1.cend(), list2);
+        EXPECT_EQ(*pos, 5);
+        EXPECT_EQ(list1, (XORList<int>{1, 2, 3, 4, 5}));
+        EXPECT_TRUE(list2.empty());
+
+        // The returned iterator stays usable for the next splice at the same place.
+        pos = list1.splice(pos, XORList<int>{42});
+        EXPECT_EQ(*pos, 5);
+        EXPECT_EQ(*--pos, 42);
+        EXPECT_EQ(list1, (XORList<int>{1, 2, 3, 4, 42, 5}));
+
+        list1.splice(list1.cbegin(), XORList<int>{0});
+        list1.splice(list1.cend(), XORList<int>{6});
+        EXPECT_EQ(list1, (XORList<int>{0, 1, 2, 3, 4, 42, 5, 6}));
+        EXPECT_EQ(list1.size(), 8);
+        ExpectConsistentLinks(list1);
+    }
+
+    TEST(XORListTest, SpliceIteratorSingleElement)
+    {
+        XORList<int> list1 = {1, 3};
+        XORList<int> list2 = {7, 2, 8};
+
+        list1.splice(++list1.cbegin(), list2, ++list2.cbegin());
+        EXPECT_EQ(list1, (XORList<int>{1, 2, 3}));
+        EXPECT_EQ(list2, (XORList<int>{7, 8}));
+        EXPECT_EQ(list1.size(), 3);
+        EXPECT_EQ(list2.size(), 2);
+
+        list1.splice(list1.cend(), list2, list2.cbegin());
+        list1.splice(list1.cbegin(), list2, list2.cbegin());
+        EXPECT_EQ(list1, (XORList<int>{8, 1, 2, 3, 7}));
+        EXPECT_TRUE(list2.empty());
+        ExpectConsistentLinks(list1);
+        ExpectConsistentLinks(list2);
+
+        // Moving an element within the same list.
+        list1.splice(list1.cbegin(), list1, --list1.cend());
+        EXPECT_EQ(list1, (XORList<int>{7, 8, 1, 2, 3}));
+        list1.splice(list1.cbegin(), list1, list1.cbegin());
+        EXPECT_EQ(list1, (XORList<int>{7, 8, 1, 2, 3}));
+        EXPECT_EQ(list1.size(), 5);
+        ExpectConsistentLinks(list1);
+    }
+
+    TEST(XORListTest, SpliceIteratorRange)
+    {
+        XORList<int> list1 = {1, 6};
+        XORList<int> list2 = {0, 2, 3, 4, 5, 9};
+
+        list1.splice(++list1.begin(), list2, ++list2.cbegin(), --list2.cend());
+        EXPECT_EQ(list1, (XORList<int>{1, 2, 3, 4, 5, 6}));
+        EXPECT_EQ(list2, (XORList<int>{0, 9}));
+        EXPECT_EQ(list1.size(), 6);
+        EXPECT_EQ(list2.size(), 2);
+        ExpectConsistentLinks(list1);
+        ExpectConsistentLinks(list2);
+
+        // Rotate a range to the front of the same list.
+        list1.splice(list1.cbegin(), list1, ++++++list1.cbegin(), list1.cend());
+        EXPECT_EQ(list1, (XORList<int>{4, 5, 6, 1, 2, 3}));
+        EXPECT_EQ(list1.size(), 6);
+        ExpectConsistentLinks(list1);
+
+        // An empty range is a no-op.
+        list1.splice(list1.cend(), list2, list2.cbegin(), list2.cbegin());
+        EXPECT_EQ(list2.size(), 2);
+    }
+
+    TEST(XORListTest, ReverseRange)
+    {
+        XORList<int> list = {1, 2, 3, 4, 5, 6};
+
+        auto last = list.reverse(++list.cbegin(), --list.cend());
+        EXPECT_EQ(*last, 6);
+        EXPECT_EQ(*--last, 2);
+        EXPECT_EQ(list, (XORList<int>{1, 5, 4, 3, 2, 6}));
+
+        list.reverse(list.cbegin(), list.cend());
+        EXPECT_EQ(list, (XORList<int>{6, 2, 3, 4, 5, 1}));
+
+        list.reverse(list.cbegin(), ++++list.cbegin());
+        list.reverse(--list.cend(), list.cend());
+        list.reverse(++list.cbegin(), ++list.cbegin());
+        EXPECT_EQ(list, (XORList<int>{2, 6, 3, 4, 5, 1}));
+
+        list.reverse(++++++list.cbegin(), list.cend());
+        EXPECT_EQ(list, (XORList<int>{2, 6, 3, 1, 5, 4}));
+        EXPECT_EQ(list.size(), 6);
+        EXPECT_EQ(list.front(), 2);
+        EXPECT_EQ(list.back(), 4);
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, ReverseRangeMatchesStdReverse)
+    {
+        std::mt19937 rng(23);
+        std::vector<int> expected(200);
+        std::iota(expected.begin(), expected.end(), 0);
+        XORList<int> list(expected.begin(), expected.end());
+
+        for (int round = 0; round < 500; ++round)
+        {
+            size_t i = rng() % (expected.size() + 1);
+            size_t j = rng() % (expected.size() + 1);
+            if (i > j)
+            {
+                std::swap(i, j);
+            }
+
+            std::reverse(expected.begin() + i, expected.begin() + j);
+            auto first = list.cbegin();
+            std::advance(first, i);
+            auto last = first;
+            std::advance(last, j - i);
+            list.reverse(first, last);
+        }
+
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), expected.begin(), expected.end()));
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, Split)
+    {
+        XORList<int> list = {1, 2, 3, 4, 5, 6, 7};
+
+        XORList<int> tail = list.split(++++++++++list.cbegin());
+        EXPECT_EQ(list, (XORList<int>{1, 2, 3, 4, 5}));
+        EXPECT_EQ(tail, (XORList<int>{6, 7}));
+        EXPECT_EQ(list.size(), 5);
+        EXPECT_EQ(tail.size(), 2);
+
+        XORList<int> rest = list.split(++list.cbegin());
+        EXPECT_EQ(list, (XORList<int>{1}));
+        EXPECT_EQ(rest, (XORList<int>{2, 3, 4, 5}));
+        EXPECT_EQ(rest.size(), 4);
+        ExpectConsistentLinks(list);
+        ExpectConsistentLinks(rest);
+        ExpectConsistentLinks(tail);
+
+        EXPECT_TRUE(list.split(list.cend()).empty());
+        EXPECT_EQ(list.size(), 1);
+
+        XORList<int> all = rest.split(rest.cbegin());
+        EXPECT_TRUE(rest.empty());
+        EXPECT_EQ(all, (XORList<int>{2, 3, 4, 5}));
+
+        // Both halves stay usable.
+        rest.push_back(8);
+        all.push_front(1);
+        EXPECT_EQ(rest, (XORList<int>{8}));
+        EXPECT_EQ(all, (XORList<int>{1, 2, 3, 4, 5}));
+    }
+
+    TEST(XORListTest, SplitIndexed)
+    {
+        XORList<int> list;
+        list.enable_index(8);
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+        for (size_t cut : {size_t(90), size_t(40), size_t(3), size_t(0)})
+        {
+            XORList<int> rest = list.split(list.cbegin() + cut);
+            EXPECT_EQ(list.size(), cut);
+            EXPECT_EQ(rest.front(), static_cast<int>(cut));
+            if (cut != 0)
+            {
+                EXPECT_EQ(list.back(), static_cast<int>(cut) - 1);
+                EXPECT_EQ(list.at(cut - 1), static_cast<int>(cut) - 1);
+            }
+            ExpectConsistentLinks(list);
+            ExpectConsistentLinks(rest);
+        }
+    }
+
+    TEST(XORListTest, Rotate)
+    {
+        XORList<int> list = {1, 2, 3, 4, 5};
+
+        auto old_first = list.rotate(++++list.cbegin());
+        EXPECT_EQ(*old_first, 1);
+        EXPECT_EQ(*--old_first, 5);
+        EXPECT_EQ(list, (XORList<int>{3, 4, 5, 1, 2}));
+        EXPECT_EQ(list.front(), 3);
+        EXPECT_EQ(list.back(), 2);
+
+        list.rotate(--list.cend());
+        EXPECT_EQ(list, (XORList<int>{2, 3, 4, 5, 1}));
+
+        EXPECT_EQ(list.rotate(list.cbegin()), list.end());
+        EXPECT_EQ(list.rotate(list.cend()), list.begin());
+        EXPECT_EQ(list, (XORList<int>{2, 3, 4, 5, 1}));
+        EXPECT_EQ(list.size(), 5);
+        ExpectConsistentLinks(list);
+
+        XORList<int> pair = {1, 2};
+        pair.rotate(++pair.cbegin());
+        EXPECT_EQ(pair, (XORList<int>{2, 1}));
+        ExpectConsistentLinks(pair);
+    }
+
+    TEST(XORListTest, At)
+    {
+        XORList<int, CanThrow::Throw> list = {10, 20, 30};
+        EXPECT_EQ(list.at(0), 10);
+        EXPECT_EQ(list.at(2), 30);
+        list.at(1) = 25;
+        EXPECT_EQ(*list.iterator_at(1), 25);
+        EXPECT_EQ(list.iterator_at(3), list.end());
+        EXPECT_THROW(list.at(3), std::out_of_range);
+        EXPECT_THROW(list.iterator_at(4), std::out_of_range);
+    }
+
+    TEST(XORListTest, AtWalksFromNearerEnd)
+    {
+        std::vector<int> values(101);
+        std::iota(values.begin(), values.end(), 0);
+        XORList<int> list(values.begin(), values.end());
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            EXPECT_EQ(list.at(i), values[i]);
+            auto it = list.iterator_at(i);
+            EXPECT_EQ(*it, values[i]);
+            if (i > 0)
+            {
+                EXPECT_EQ(*--it, values[i - 1]); // the predecessor is right after a walk from the tail too
+            }
+        }
+
+        list.enable_index(10);
+        for (size_t i = 0; i + 1 < values.size(); ++i)
+        {
+            auto it = list.iterator_at(i);
+            EXPECT_EQ(*it, values[i]);
+            EXPECT_EQ(*++it, values[i + 1]);
+        }
+
+        XORList<int> batch = {-1, -2};
+        list.splice(99, batch);
+        EXPECT_EQ(list.at(98), 98);
+        EXPECT_EQ(list.at(99), -1);
+        EXPECT_EQ(list.at(101), 99);
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, IteratorDistanceIsSignedWithAndWithoutIndex)
+    {
+        std::mt19937 rng(9);
+        XORList<int> list;
+        for (int i = 0; i < 200; ++i)
+        {
+            list.push_front(i); // nodes in reverse address order, so pointer order says nothing about position
+        }
+        for (bool indexed : {false, true})
+        {
+            if (indexed)
+            {
+                list.enable_index(8);
+            }
+            EXPECT_EQ(list.begin() - list.end(), -200);
+            EXPECT_EQ(list.end() - list.begin(), 200);
+            for (int trial = 0; trial < 200; ++trial)
+            {
+                std::ptrdiff_t a = rng() % 201;
+                std::ptrdiff_t b = rng() % 201;
+                auto it_a = std::next(list.begin(), a);
+                auto it_b = std::next(list.begin(), b);
+                EXPECT_EQ(it_a - it_b, a - b);
+                EXPECT_EQ(it_b - it_a, b - a);
+                EXPECT_EQ(it_a < it_b, a < b);
+            }
+        }
+    }
+
+    TEST(XORListTest, ConstQueriesOnStaleIndex)
+    {
+        XORList<int> list;
+        list.enable_index(8);
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+        list.erase(list.iterator_at(10)); // leaves the index stale
+        list.push_front(-1);
+
+        // Const queries walk instead of rebuilding, so several threads may run them at once.
+        const XORList<int> &shared = list;
+        std::vector<std::thread> readers;
+        std::atomic<int> mismatches{0};
+        for (int reader = 0; reader < 4; ++reader)
+        {
+            readers.emplace_back([&shared, &mismatches, reader]
+                                 {
+                                     for (size_t i = reader; i < shared.size(); i += 4)
+                                     {
+                                         int expected = i == 0 ? -1 : static_cast<int>(i <= 10 ? i - 1 : i);
+                                         if (shared.at(i) != expected || shared.iterator_at(i) - shared.cbegin() != static_cast<std::ptrdiff_t>(i))
+                                         {
+                                             ++mismatches;
+                                         }
+                                     } });
+        }
+        for (std::thread &reader : readers)
+        {
+            reader.join();
+        }
+        EXPECT_EQ(mismatches.load(), 0);
+
+        list.rebuild_index();
+        EXPECT_EQ(shared.at(500), 500);
+        EXPECT_EQ(shared.cend() - shared.iterator_at(990), 10);
+    }
+
+    TEST(XORListTest, PositionIndex)
+    {
+        XORList<int> list;
+        list.enable_index(4);
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+
+        for (size_t i = 0; i < list.size(); ++i)
+        {
+            EXPECT_EQ(list.at(i), static_cast<int>(i));
+        }
+
+        auto it = list.begin() + 37;
+        EXPECT_EQ(*it, 37);
+        EXPECT_EQ(*(it - 30), 7);
+        EXPECT_EQ(*(it + 5), 42);
+        EXPECT_EQ(it - list.begin(), 37);
+        EXPECT_EQ(list.begin() - it, -37);
+        EXPECT_EQ(list.end() - it, 63);
+        EXPECT_EQ(it + 1000, list.end());
+        EXPECT_EQ(it - 1000, list.begin());
+        EXPECT_TRUE(list.begin() < it);
+        EXPECT_FALSE(it < list.begin());
+
+        // Appends and pops at the back keep the index current; everything else rebuilds it lazily.
+        list.pop_back();
+        list.push_back(99);
+        list.push_back(100);
+        EXPECT_EQ(list.at(100), 100);
+        list.push_front(-1);
+        list.erase(list.iterator_at(50));
+        list.reverse(list.cbegin() + 10, list.cbegin() + 20);
+        XORList<int> batch = {7, 8, 9};
+        list.splice(60, batch);
+
+        std::vector<int> expected(list.cbegin(), list.cend());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(list.at(i), expected[i]);
+        }
+        EXPECT_EQ(list.end() - list.begin(), static_cast<std::ptrdiff_t>(list.size()));
+
+        // Iterators walking backwards are still served by the plain walk.
+        auto rit = list.rbegin() + 2;
+        EXPECT_EQ(*rit, expected[expected.size() - 3]);
+
+        XORList<int> copy = list;
+        EXPECT_EQ(copy.at(70), expected[70]);
+        list.disable_index();
+        EXPECT_EQ(list.at(70), expected[70]);
+    }
+
+    TEST(XORListTest, CursorSequentialAccess)
+    {
+        std::vector<int> values(500);
+        std::iota(values.begin(), values.end(), 0);
+        XORList<int> list(values.begin(), values.end());
+
+        auto cursor = list.make_cursor();
+        for (size_t i = 0; i < values.size(); i += 3)
+        {
+            EXPECT_EQ(cursor.at(i), values[i]);
+        }
+        for (size_t i = values.size(); i-- > 0;)
+        {
+            EXPECT_EQ(cursor.at(i), values[i]);
+        }
+        EXPECT_EQ(cursor.position(), 0);
+
+        cursor.at(250) = -250;
+        EXPECT_EQ(list.at(250), -250);
+        EXPECT_EQ(cursor.seek(list.size()), list.end());
+
+        const XORList<int> &view = list;
+        auto const_cursor = view.make_cursor();
+        EXPECT_EQ(const_cursor.at(499), 499);
+        EXPECT_EQ(*--const_cursor.seek(10), 9);
+    }
+
+    TEST(XORListTest, CursorSurvivesPushesAtTheEnds)
+    {
+        XORList<int> list = {3, 4, 5};
+        auto cursor = list.make_cursor();
+        EXPECT_EQ(cursor.at(0), 3);
+
+        list.push_front(2);
+        list.emplace_front(1);
+        list.push_back(6);
+        EXPECT_EQ(cursor.position(), 0);
+        EXPECT_EQ(cursor.at(2), 3);
+        EXPECT_EQ(cursor.at(5), 6);
+
+        list.push_front(0);
+        list.push_back(7);
+        EXPECT_EQ(cursor.at(7), 7);
+        EXPECT_EQ(cursor.at(4), 4);
+        EXPECT_EQ(cursor.at(0), 0);
+
+        // Other changes make the cursor seek again instead of following stale links.
+        list.erase(list.iterator_at(3));
+        list.pop_front();
+        list.pop_back();
+        EXPECT_EQ(cursor.at(2), 4);
+        EXPECT_EQ(cursor.at(4), 6);
+        list.reverse();
+        EXPECT_EQ(cursor.at(0), 6);
+        EXPECT_EQ(cursor.at(4), 1);
+    }
+
+    TEST(XORListTest, CursorCountersLiveOffTheList)
+    {
+        // Head, tail, size and the allocator, plus one pointer each for the index and the cursor counters.
+        EXPECT_LE(sizeof(XORList<int>), 6 * sizeof(void *));
+
+        XORList<int> list = {1, 2, 3, 4};
+        auto cursor = std::as_const(list).make_cursor(); // the first cursor, made from a const list
+        EXPECT_EQ(cursor.at(2), 3);
+        list.push_front(0);
+        EXPECT_EQ(cursor.at(3), 3);
+        list.erase(list.iterator_at(1));
+        EXPECT_EQ(cursor.at(1), 2);
+
+        XORList<int> other = {7, 8, 9};
+        auto other_cursor = other.make_cursor();
+        EXPECT_EQ(other_cursor.at(1), 8);
+        list.swap(other); // the counters stay with their list, and both cursors re-seek
+        EXPECT_EQ(cursor.at(1), 8);
+        EXPECT_EQ(other_cursor.at(1), 2);
+
+        XORList<int> moved(std::move(list));
+        auto moved_cursor = moved.make_cursor();
+        EXPECT_EQ(moved_cursor.at(2), 9);
+        EXPECT_EQ(cursor.seek(0), list.end());
+    }
+
+    TEST(XORListTest, CursorThrowsOutOfRange)
+    {
+        XORList<int, CanThrow::Throw> list = {1, 2};
+        auto cursor = list.make_cursor();
+        EXPECT_EQ(cursor.at(1), 2);
+        EXPECT_THROW(cursor.at(2), std::out_of_range);
+        EXPECT_THROW(cursor.seek(3), std::out_of_range);
+        EXPECT_EQ(cursor.seek(2), list.end());
+
+        // Without exceptions an out-of-range cursor lookup falls back the same way at() does, not onto end().
+        XORList<int> quiet = {1, 2};
+        auto quiet_cursor = quiet.make_cursor();
+        EXPECT_EQ(&quiet_cursor.at(5), &quiet.at(5));
+    }
+
+    TEST(XORListTest, AppendAndPrependRange)
+    {
+        std::vector<int> tail = {4, 5, 6};
+        XORList<int> list = {2, 3};
+
+        list.append_range(tail);
+        list.prepend_range(std::vector<int>{0, 1});
+        list.append_range(tail.begin(), tail.begin());
+        EXPECT_EQ(list, (XORList<int>{0, 1, 2, 3, 4, 5, 6}));
+        EXPECT_EQ(list.size(), 7);
+        ExpectConsistentLinks(list);
+
+        XORList<int> empty;
+        empty.prepend_range(tail);
+        EXPECT_EQ(empty, (XORList<int>{4, 5, 6}));
+        ExpectConsistentLinks(empty);
+
+        // Single-pass input is built node by node.
+        std::istringstream input("7 8 9");
+        list.append_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+        EXPECT_EQ(list.size(), 10);
+        EXPECT_EQ(list.back(), 9);
+    }
+
+    TEST(XORListTest, InsertRangeReturnsFirstInserted)
+    {
+        XORList<int> list = {1, 5};
+        std::vector<int> middle = {2, 3, 4};
+
+        auto it = list.insert(++list.cbegin(), middle.begin(), middle.end());
+        EXPECT_EQ(*it, 2);
+        EXPECT_EQ(*--it, 1);
+        EXPECT_EQ(list, (XORList<int>{1, 2, 3, 4, 5}));
+
+        it = list.insert(list.cend(), {6, 7});
+        EXPECT_EQ(*it, 6);
+        it = list.insert(list.cbegin(), middle.begin(), middle.begin());
+        EXPECT_EQ(it, list.begin());
+        EXPECT_EQ(list.size(), 7);
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, RangeInsertThrowingLeavesListIntact)
+    {
+        struct Fragile
+        {
+            int value;
+            Fragile(int v) : value(v)
+            {
+                if (v < 0)
+                {
+                    throw std::invalid_argument("negative");
+                }
+            }
+        };
+
+        std::vector<int> values = {1, 2, -3, 4};
+        XORList<Fragile, CanThrow::Throw> list;
+        list.emplace_back(0);
+        EXPECT_THROW(list.append_range(values.begin(), values.end()), std::invalid_argument);
+        EXPECT_THROW(list.insert(list.cbegin(), values.begin(), values.end()), std::invalid_argument);
+        EXPECT_EQ(list.size(), 1);
+        EXPECT_EQ(list.front().value, 0);
+    }
+
+    struct Pair
+    {
+        int first;
+        int second;
+    };
+
+    TEST(XORListTest, PushBracedDefault)
+    {
+        // A value-initialized element, as with std::list; node handles only go through insert().
+        XORList<std::string> strings;
+        strings.push_back({});
+        strings.push_front({});
+        EXPECT_EQ(strings, (XORList<std::string>{"", ""}));
+
+        XORList<Pair> pairs;
+        pairs.push_back({});
+        pairs.push_front({1, 2});
+        EXPECT_EQ(pairs.front().second, 2);
+        EXPECT_EQ(pairs.back().first, 0);
+    }
+
+    TEST(XORListTest, ExtractAndInsertNode)
+    {
+        XORList<std::string> from = {"a", "b", "c"};
+        XORList<std::string> to = {"x", "z"};
+
+        const std::string *address = &*++from.cbegin();
+        auto node = from.extract(++from.cbegin());
+        EXPECT_FALSE(node.empty());
+        EXPECT_EQ(node.value(), "b");
+        EXPECT_EQ(from, (XORList<std::string>{"a", "c"}));
+        EXPECT_EQ(from.size(), 2);
+
+        node.value() = "y";
+        auto it = to.insert(++to.cbegin(), std::move(node));
+        EXPECT_TRUE(node.empty());
+        EXPECT_EQ(&*it, address);
+        EXPECT_EQ(*--it, "x");
+        EXPECT_EQ(to, (XORList<std::string>{"x", "y", "z"}));
+
+        to.insert(to.cend(), from.extract(from.cbegin()));
+        to.insert(to.cbegin(), from.extract(from.cbegin()));
+        EXPECT_TRUE(from.empty());
+        EXPECT_EQ(to, (XORList<std::string>{"c", "x", "y", "z", "a"}));
+        EXPECT_EQ(to.size(), 5);
+        ExpectConsistentLinks(from);
+        ExpectConsistentLinks(to);
+
+        EXPECT_TRUE(from.extract(from.cend()).empty());
+        EXPECT_EQ(to.insert(to.cend(), XORList<std::string>::node_type()), to.end());
+        EXPECT_EQ(to.size(), 5);
+
+        // A handle that is never reinserted frees its node.
+        {
+            auto dropped = to.extract(--to.cend());
+            EXPECT_EQ(dropped.value(), "a");
+        }
+        EXPECT_EQ(to.size(), 4);
+        EXPECT_EQ(to.back(), "z");
+    }
+
+    TEST(XORListTest, SerializeRoundTrip)
+    {
+        XORList<int> list;
+        for (int i = 0; i < 100000; ++i) // spans several 64 KiB blocks
+        {
+            list.push_back(i * 3);
+        }
+
+        std::stringstream stream;
+        EXPECT_TRUE(list.write_to(stream));
+        XORList<int> loaded{1, 2, 3};
+        EXPECT_TRUE(loaded.read_from(stream));
+        EXPECT_EQ(loaded, list);
+        ExpectConsistentLinks(loaded);
+
+        XORList<int> empty;
+        std::stringstream empty_stream;
+        EXPECT_TRUE(empty.write_to(empty_stream));
+        EXPECT_TRUE(loaded.read_from(empty_stream));
+        EXPECT_TRUE(loaded.empty());
+    }
+
+    // Length-prefixed strings, as an example of a codec for a type that is not trivially copyable.
+    struct StringCodec
+    {
+        void encode(std::ostream &out, const std::string &value) const
+        {
+            std::uint32_t length = static_cast<std::uint32_t>(value.size());
+            out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+            out.write(value.data(), length);
+        }
+
+        std::string decode(std::istream &in) const
+        {
+            std::uint32_t length = 0;
+            in.read(reinterpret_cast<char *>(&length), sizeof(length));
+            std::string value(in ? length : 0, '\0');
+            in.read(value.data(), static_cast<std::streamsize>(value.size()));
+            return value;
+        }
+    };
+
+    TEST(XORListTest, SerializeWithCodec)
+    {
+        XORList<std::string> list{"", "one", std::string(1000, 'x'), "three"};
+        std::stringstream stream;
+        EXPECT_TRUE(list.write_to(stream, StringCodec()));
+
+        XORList<std::string> loaded;
+        EXPECT_TRUE(loaded.read_from(stream, StringCodec()));
+        EXPECT_EQ(loaded, list);
+    }
+
+    TEST(XORListTest, SerializeToBuffer)
+    {
+        XORList<double> first{1.5, 2.5};
+        XORList<double> second{-1.0, 0.0, 1.0};
+        std::vector<unsigned char> buffer;
+        EXPECT_TRUE(first.write_to(buffer));
+        EXPECT_TRUE(second.write_to(buffer));
+
+        XORList<double> loaded;
+        size_t consumed = loaded.read_from(buffer.data(), buffer.size());
+        ASSERT_GT(consumed, 0u);
+        EXPECT_EQ(loaded, first);
+        EXPECT_EQ(loaded.read_from(buffer.data() + consumed, buffer.size() - consumed), buffer.size() - consumed);
+        EXPECT_EQ(loaded, second);
+    }
+
+    TEST(XORListTest, ReadFromMalformedStreamLeavesListIntact)
+    {
+        XORList<int> list{1, 2, 3, 4, 5};
+        std::vector<unsigned char> buffer;
+        list.write_to(buffer);
+
+        XORList<int> target{9, 9};
+        EXPECT_EQ(target.read_from(buffer.data(), buffer.size() - 1), 0u);
+        EXPECT_EQ(target, XORList<int>({9, 9}));
+
+        XORList<long> wrong_type;
+        EXPECT_EQ(wrong_type.read_from(buffer.data(), buffer.size()), 0u);
+        EXPECT_TRUE(wrong_type.empty());
+
+        XORList<int, CanThrow::Throw> throwing{9};
+        std::stringstream truncated(std::string(buffer.begin(), buffer.end() - 4));
+        EXPECT_THROW(throwing.read_from(truncated), std::ios_base::failure);
+        EXPECT_EQ(throwing.size(), 1);
+    }
+
+    TEST(XORListTest, Compact)
+    {
+        XORList<std::string> list;
+        std::list<std::string> expected;
+        std::mt19937 rng(11);
+        for (int i = 0; i < 2000; ++i)
+        {
+            size_t position = rng() % (expected.size() + 1);
+            list.insert(list.iterator_at(position), std::to_string(i));
+            expected.insert(std::next(expected.begin(), position), std::to_string(i));
+            if (i % 3 == 0)
+            {
+                list.pop_front();
+                expected.pop_front();
+            }
+        }
+
+        list.compact();
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        ExpectConsistentLinks(list);
+
+        XORList<std::string> empty;
+        empty.compact();
+        EXPECT_TRUE(empty.empty());
+    }
+
+    TEST(XORListTest, CompactorSteps)
+    {
+        XORList<int> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+
+        auto compactor = list.make_compactor();
+        int steps = 1;
+        while (!compactor.step(16))
+        {
+            ++steps;
+        }
+        EXPECT_EQ(steps, 7);
+        EXPECT_TRUE(compactor.done());
+        EXPECT_EQ(list.size(), 100);
+        EXPECT_EQ(list.front(), 0);
+        EXPECT_EQ(list.back(), 99);
+        ExpectConsistentLinks(list);
+
+        // Reshaping the list between steps makes the compactor start over.
+        list.pop_front();
+        EXPECT_FALSE(compactor.done());
+        EXPECT_FALSE(compactor.step(40));
+        list.push_front(-1);
+        EXPECT_FALSE(compactor.step(50));
+        EXPECT_TRUE(compactor.step(50));
+        std::vector<int> expected{-1};
+        for (int i = 1; i < 100; ++i)
+        {
+            expected.push_back(i);
+        }
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        ExpectConsistentLinks(list);
+    }
+
+    TEST(XORListTest, FreezeAndThaw)
+    {
+        XORList<std::string> list{"a", "b", "c"};
+        list.push_front("z");
+
+        FrozenXORList<std::string> frozen = list.freeze();
+        ASSERT_EQ(frozen.size(), 4);
+        EXPECT_EQ(frozen[0], "z");
+        EXPECT_EQ(frozen.at(3), "c");
+        EXPECT_EQ(frozen.front(), "z");
+        EXPECT_EQ(frozen.back(), "c");
+        EXPECT_EQ(frozen.end() - frozen.begin(), 4);
+        EXPECT_EQ(&frozen[1] + 1, &frozen[2]);
+        EXPECT_TRUE(std::equal(frozen.rbegin(), frozen.rend(), std::list<std::string>{"c", "b", "a", "z"}.begin()));
+        EXPECT_EQ(list.size(), 4);
+
+        XORList<std::string> thawed = frozen.thaw();
+        EXPECT_EQ(thawed, list);
+        thawed.push_back("d");
+        ExpectConsistentLinks(thawed);
+
+        FrozenXORList<std::string> moved = std::move(thawed).freeze();
+        EXPECT_TRUE(thawed.empty());
+        EXPECT_EQ(moved.back(), "d");
+        XORList<std::string> again = std::move(moved).thaw();
+        EXPECT_TRUE(moved.empty());
+        EXPECT_EQ(again.size(), 5);
+        EXPECT_EQ(again.back(), "d");
+    }
+
+    TEST(XORListTest, FrozenAtThrows)
+    {
+        XORList<int, CanThrow::Throw> list{1, 2};
+        auto frozen = list.freeze();
+        EXPECT_EQ(frozen.at(1), 2);
+        EXPECT_THROW(frozen.at(2), std::out_of_range);
+        FrozenXORList<int, CanThrow::Throw> empty;
+        EXPECT_THROW(empty.front(), std::runtime_error);
+    }
+
+    TEST(XORListTest, PrefetchingAlgorithmsMatchStd)
+    {
+        XORList<int> list;
+        std::mt19937 rng(11);
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(static_cast<int>(rng() % 50));
+        }
+        std::vector<int> expected(list.begin(), list.end());
+
+        for (size_t distance : {size_t(0), size_t(1), XORList<int>::prefetch_distance, size_t(5000)})
+        {
+            EXPECT_EQ(list.accumulate(0LL, std::plus<>(), distance), std::accumulate(expected.begin(), expected.end(), 0LL));
+            EXPECT_EQ(list.count(7, distance), static_cast<size_t>(std::count(expected.begin(), expected.end(), 7)));
+            auto odd = [](int value)
+            {
+                return value % 2 != 0;
+            };
+            EXPECT_EQ(list.count_if(odd, distance), static_cast<size_t>(std::count_if(expected.begin(), expected.end(), odd)));
+
+            auto found = list.find(expected[600], distance);
+            EXPECT_EQ(std::distance(list.begin(), found), std::find(expected.begin(), expected.end(), expected[600]) - expected.begin());
+            EXPECT_TRUE(list.find(-1, distance) == list.end());
+
+            std::vector<int> visited;
+            std::as_const(list).for_each([&](const int &value)
+                                         { visited.push_back(value); },
+                                         distance);
+            EXPECT_EQ(visited, expected);
+        }
+    }
+
+    TEST(XORListTest, PrefetchingFindAndForEach)
+    {
+        XORList<std::string> list{"a", "bb", "ccc", "dd"};
+        auto it = list.find_if([](const std::string &value)
+                               { return value.size() == 3; });
+        ASSERT_TRUE(it != list.end());
+        EXPECT_EQ(*it, "ccc");
+        EXPECT_EQ(*--it, "bb"); // the returned iterator carries its predecessor
+
+        list.for_each([](std::string &value)
+                      { value += "!"; });
+        EXPECT_EQ(list.front(), "a!");
+        EXPECT_EQ(list.back(), "dd!");
+        EXPECT_EQ(list.accumulate(std::string()), "a!bb!ccc!dd!");
+
+        XORList<std::string> empty;
+        EXPECT_TRUE(empty.find("a") == empty.end());
+        EXPECT_EQ(empty.count("a"), 0u);
+    }
+
+    TEST(XORListTest, FindBidirectionalReturnsFirstMatch)
+    {
+        std::mt19937 rng(5);
+        for (size_t size = 0; size < 40; ++size)
+        {
+            XORList<int> list;
+            std::vector<int> expected;
+            for (size_t i = 0; i < size; ++i)
+            {
+                int value = static_cast<int>(rng() % 6); // small range, so most values repeat in both halves
+                list.push_back(value);
+                expected.push_back(value);
+            }
+            for (int value = -1; value < 7; ++value)
+            {
+                auto found = list.find_bidirectional(value);
+                auto expected_found = std::find(expected.begin(), expected.end(), value);
+                EXPECT_EQ(std::distance(list.begin(), found), expected_found - expected.begin());
+            }
+        }
+    }
+
+    TEST(XORListTest, FindIfBidirectional)
+    {
+        XORList<int> list{1, 2, 3, 4, 5, 6, 7};
+        auto it = list.find_if_bidirectional([](int value)
+                                             { return value >= 6; });
+        ASSERT_TRUE(it != list.end());
+        EXPECT_EQ(*it, 6);
+        EXPECT_EQ(*--it, 5);
+        EXPECT_EQ(*++(++it), 7);
+
+        *list.find_bidirectional(4) = 40;
+        EXPECT_TRUE(std::as_const(list).find_bidirectional(40) == std::next(list.cbegin(), 3));
+        EXPECT_TRUE(list.find_bidirectional(4) == list.end());
+    }
+
+    TEST(XORListTest, ParallelAlgorithmsMatchSequential)
+    {
+        XORList<int> list;
+        std::vector<int> expected;
+        std::mt19937 rng(13);
+        for (int i = 0; i < 50000; ++i)
+        {
+            int value = static_cast<int>(rng() % 1000);
+            list.push_back(value);
+            expected.push_back(value);
+        }
+        auto even = [](int value)
+        {
+            return value % 2 == 0;
+        };
+        long long sum = std::accumulate(expected.begin(), expected.end(), 0LL);
+        size_t evens = static_cast<size_t>(std::count_if(expected.begin(), expected.end(), even));
+
+        for (size_t threads : {size_t(0), size_t(1), size_t(3), size_t(8), size_t(1000)})
+        {
+            // Const calls on a list without an index find the cuts with a walk.
+            EXPECT_EQ(std::as_const(list).parallel_reduce(0LL, std::plus<>(), threads), sum);
+            EXPECT_EQ(std::as_const(list).parallel_count_if(even, threads), evens);
+        }
+        for (bool indexed : {false, true})
+        {
+            if (indexed)
+            {
+                list.enable_index(100); // stride that does not divide the size, so the last span is short
+            }
+            for (size_t threads : {size_t(0), size_t(1), size_t(3), size_t(8), size_t(1000)})
+            {
+                EXPECT_EQ(list.parallel_reduce(0LL, std::plus<>(), threads), sum);
+                EXPECT_EQ(list.parallel_count_if(even, threads), evens);
+                EXPECT_EQ(std::as_const(list).parallel_count_if(even, threads), evens);
+            }
+        }
+
+        // Order matters to a non-commutative reduction, so this checks that the spans are combined in list order.
+        auto concatenate = [](std::string acc, const std::string &digits)
+        {
+            return acc + digits;
+        };
+        XORList<std::string> digits;
+        std::string expected_digits;
+        for (int i = 0; i < 20000; ++i)
+        {
+            digits.push_back(std::to_string(i % 10));
+            expected_digits += std::to_string(i % 10);
+        }
+        EXPECT_EQ(digits.parallel_reduce(std::string(), concatenate, 4), expected_digits);
+    }
+
+    TEST(XORListTest, ParallelSplitSurvivesReshapes)
+    {
+        XORList<int> list;
+        std::list<int> expected;
+        for (int i = 0; i < 30000; ++i)
+        {
+            list.push_back(i);
+            expected.push_back(i);
+        }
+        auto check = [&]
+        {
+            long long sum = std::accumulate(expected.begin(), expected.end(), 0LL);
+            EXPECT_EQ(list.parallel_reduce(0LL, std::plus<>(), 4), sum);
+            EXPECT_EQ(std::as_const(list).parallel_reduce(0LL, std::plus<>(), 4), sum);
+            EXPECT_EQ(list.parallel_count_if([](int)
+                                             { return true; },
+                                             4),
+                      expected.size());
+        };
+
+        check(); // the first non-const call enables the index the later ones split by
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.push_back(-i);
+            expected.push_back(-i);
+            list.push_front(i);
+            expected.push_front(i);
+        }
+        check();
+        list.erase(std::next(list.begin(), 100), std::next(list.begin(), 9000));
+        expected.erase(std::next(expected.begin(), 100), std::next(expected.begin(), 9000));
+        check(); // stale after the erase: the const call walks, the non-const ones rebuild
+        list.reverse();
+        expected.reverse();
+        check();
+        while (list.size() > 10000)
+        {
+            list.pop_back();
+            expected.pop_back();
+        }
+        check();
+    }
+
+    TEST(XORListTest, ParallelForEach)
+    {
+        XORList<int> list(40000, 1);
+        list.parallel_for_each([](int &value)
+                               { value *= 3; },
+                               4);
+        EXPECT_EQ(list.parallel_count_if([](int value)
+                                         { return value == 3; },
+                                         4),
+                  40000u);
+
+        std::atomic<long long> total{0};
+        std::as_const(list).parallel_for_each([&](const int &value)
+                                              { total += value; });
+        EXPECT_EQ(total.load(), 120000);
+
+        XORList<int> empty;
+        EXPECT_EQ(empty.parallel_reduce(5), 5);
+        EXPECT_EQ(empty.parallel_count_if([](int)
+                                          { return true; }),
+                  0u);
+    }
+
+    TEST(XORListTest, ParallelForEachRethrows)
+    {
+        XORList<int> list(40000, 0);
+        list.back() = 1;
+        EXPECT_THROW(list.parallel_for_each([](int value)
+                                            {
+                                                if (value == 1)
+                                                {
+                                                    throw std::runtime_error("last");
+                                                } },
+                                            4),
+                     std::runtime_error);
+    }
+
     // Boundary Conditions
 
     TEST(XORListTest, MaxSizeBoundary)
@@ -0,0 +1,266 @@
+#include <XORListForest.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace scc
+{
+    template <typename Forest, typename T>
+    static void ExpectListEquals(const Forest &forest, size_t id, const std::list<T> &expected)
+    {
+        ASSERT_EQ(forest.size(id), expected.size());
+        EXPECT_TRUE(std::equal(forest.cbegin(id), forest.cend(id), expected.cbegin()));
+
+        // Walk backwards from the end as well, so both directions of the XOR links are checked.
+        auto it = forest.cend(id);
+        for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit)
+        {
+            --it;
+            EXPECT_EQ(*it, *rit);
+        }
+        EXPECT_TRUE(it == forest.cbegin(id));
+    }
+
+    TEST(XORListForestTest, PushPopBothEnds)
+    {
+        XORListForest<int> forest(3);
+        std::vector<std::list<int>> expected(3);
+        for (int i = 0; i < 300; ++i)
+        {
+            size_t id = i % 3;
+            if (i % 2 == 0)
+            {
+                forest.push_back(id, i);
+                expected[id].push_back(i);
+            }
+            else
+            {
+                forest.push_front(id, i);
+                expected[id].push_front(i);
+            }
+        }
+        forest.pop_back(0);
+        expected[0].pop_back();
+        forest.pop_front(1);
+        expected[1].pop_front();
+
+        for (size_t id = 0; id < 3; ++id)
+        {
+            ExpectListEquals(forest, id, expected[id]);
+        }
+        EXPECT_EQ(forest.total_size(), 298u);
+        EXPECT_EQ(forest.front(2), expected[2].front());
+        EXPECT_EQ(forest.back(2), expected[2].back());
+    }
+
+    TEST(XORListForestTest, FreedSlotsAreReused)
+    {
+        XORListForest<int> forest(2);
+        for (int i = 0; i < 100; ++i)
+        {
+            forest.push_back(0, i);
+        }
+        size_t capacity = forest.capacity();
+        forest.clear(0);
+        EXPECT_TRUE(forest.empty(0));
+        for (int i = 0; i < 100; ++i)
+        {
+            forest.push_back(1, i);
+        }
+        EXPECT_EQ(forest.capacity(), capacity);
+        ExpectListEquals(forest, 1, std::list<int>(forest.cbegin(1), forest.cend(1)));
+    }
+
+    TEST(XORListForestTest, RangeForAndErase)
+    {
+        XORListForest<std::string> forest;
+        size_t id = forest.add_list();
+        for (const char *word : {"a", "b", "c", "d"})
+        {
+            forest.emplace_back(id, word);
+        }
+        for (auto it = forest.begin(id); it != forest.end(id);)
+        {
+            it = (*it == "b" || *it == "d") ? forest.erase(id, it) : std::next(it);
+        }
+
+        std::string joined;
+        for (const std::string &word : forest.elements(id))
+        {
+            joined += word;
+        }
+        EXPECT_EQ(joined, "ac");
+        ExpectListEquals(forest, id, std::list<std::string>{"a", "c"});
+    }
+
+    TEST(XORListForestTest, SpliceWholeList)
+    {
+        XORListForest<int> forest(2);
+        for (int i = 0; i < 4; ++i)
+        {
+            forest.push_back(0, i);
+            forest.push_back(1, 10 + i);
+        }
+
+        auto pos = forest.splice(0, std::next(forest.cbegin(0), 2), 1);
+        EXPECT_EQ(*pos, 2);
+        EXPECT_EQ(*std::prev(pos), 13);
+        ExpectListEquals(forest, 0, std::list<int>{0, 1, 10, 11, 12, 13, 2, 3});
+        EXPECT_TRUE(forest.empty(1));
+
+        forest.splice(1, forest.cend(1), 0);
+        ExpectListEquals(forest, 1, std::list<int>{0, 1, 10, 11, 12, 13, 2, 3});
+        EXPECT_TRUE(forest.empty(0));
+    }
+
+    TEST(XORListForestTest, SpliceOneElement)
+    {
+        XORListForest<int> forest(2);
+        for (int i = 0; i < 4; ++i)
+        {
+            forest.push_back(0, i);
+        }
+        forest.push_back(1, 42);
+
+        forest.splice(1, forest.cbegin(1), 0, std::next(forest.cbegin(0)));
+        forest.splice(1, forest.cend(1), 0, forest.cbegin(0));
+        ExpectListEquals(forest, 0, std::list<int>{2, 3});
+        ExpectListEquals(forest, 1, std::list<int>{1, 42, 0});
+
+        // Moving an element within its own list.
+        forest.splice(1, forest.cbegin(1), 1, std::prev(forest.cend(1)));
+        ExpectListEquals(forest, 1, std::list<int>{0, 1, 42});
+        EXPECT_EQ(forest.total_size(), 5u);
+    }
+
+    TEST(XORListForestTest, AssignPairs)
+    {
+        std::vector<std::pair<int, int>> edges = {{0, 1}, {2, 0}, {0, 2}, {1, 2}, {2, 1}, {0, 3}};
+        XORListForest<int> forest;
+        forest.assign_pairs(4, edges.begin(), edges.end());
+
+        ASSERT_EQ(forest.list_count(), 4u);
+        ExpectListEquals(forest, 0, std::list<int>{1, 2, 3});
+        ExpectListEquals(forest, 1, std::list<int>{2});
+        ExpectListEquals(forest, 2, std::list<int>{0, 1});
+        EXPECT_TRUE(forest.empty(3));
+        EXPECT_EQ(forest.total_size(), edges.size());
+    }
+
+    TEST(XORListForestTest, AssignPairsLaysListsOutContiguously)
+    {
+        std::vector<std::pair<size_t, int>> edges;
+        for (int i = 0; i < 3000; ++i)
+        {
+            edges.emplace_back(static_cast<size_t>(i * 7) % 10, i);
+        }
+        XORListForest<int> forest(2);
+        forest.push_back(1, 42); // replaced by the assignment
+        forest.assign_pairs(12, edges.begin(), edges.end());
+
+        std::vector<std::list<int>> expected(12);
+        for (const auto &[id, value] : edges)
+        {
+            expected[id].push_back(value);
+        }
+        // Neighbours sit in adjacent slots, except where a run crosses into the next of the arena's 9 chunks.
+        size_t gaps = 0;
+        for (size_t id = 0; id < expected.size(); ++id)
+        {
+            ExpectListEquals(forest, id, expected[id]);
+            const int *previous = nullptr;
+            for (const int &value : forest.elements(id))
+            {
+                if (previous != nullptr &&
+                    reinterpret_cast<const unsigned char *>(&value) - reinterpret_cast<const unsigned char *>(previous) !=
+                        static_cast<std::ptrdiff_t>(XORListForest<int>::node_size))
+                {
+                    ++gaps;
+                }
+                previous = &value;
+            }
+        }
+        EXPECT_LE(gaps, 8u);
+        EXPECT_EQ(forest.total_size(), edges.size());
+
+        // The lists stay ordinary lists afterwards.
+        forest.push_front(10, -1);
+        forest.push_back(0, -2);
+        expected[10].push_front(-1);
+        expected[0].push_back(-2);
+        ExpectListEquals(forest, 10, expected[10]);
+        ExpectListEquals(forest, 0, expected[0]);
+    }
+
+    // Throws when constructed from a negative value.
+    struct Picky
+    {
+        int value;
+
+        Picky(int v) : value(v)
+        {
+            if (v < 0)
+            {
+                throw std::invalid_argument("negative");
+            }
+        }
+    };
+
+    TEST(XORListForestTest, AssignPairsThrowLeavesEmptyLists)
+    {
+        std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {0, 3}, {1, -1}, {0, 4}};
+        XORListForest<Picky, CanThrow::Throw> forest;
+        EXPECT_THROW(forest.assign_pairs(2, edges.begin(), edges.end()), std::invalid_argument);
+        EXPECT_EQ(forest.list_count(), 2u);
+        EXPECT_TRUE(forest.empty(0));
+        EXPECT_TRUE(forest.empty(1));
+        EXPECT_EQ(forest.total_size(), 0u);
+        forest.push_back(0, 5);
+        EXPECT_EQ(forest.front(0).value, 5);
+    }
+
+    TEST(XORListForestTest, ManyTinyLists)
+    {
+        constexpr size_t lists = 50000;
+        XORListForest<int> forest(lists);
+        for (size_t id = 0; id < lists; ++id)
+        {
+            for (size_t i = 0; i < id % 4; ++i)
+            {
+                forest.push_back(id, static_cast<int>(id + i));
+            }
+        }
+        for (size_t id = 0; id < lists; id += 997)
+        {
+            std::list<int> expected;
+            for (size_t i = 0; i < id % 4; ++i)
+            {
+                expected.push_back(static_cast<int>(id + i));
+            }
+            ExpectListEquals(forest, id, expected);
+        }
+    }
+
+    TEST(XORListForestTest, ThrowOnEmpty)
+    {
+        XORListForest<int, CanThrow::Throw> forest(1);
+        EXPECT_THROW(forest.pop_back(0), std::runtime_error);
+        EXPECT_THROW(forest.front(0), std::runtime_error);
+
+        XORListForest<int> quiet(1);
+        quiet.pop_front(0);
+        EXPECT_TRUE(quiet.empty(0));
+    }
+
+    TEST(XORListForestTest, MoveConstruct)
+    {
+        XORListForest<std::string> forest(1);
+        forest.push_back(0, "moved");
+        XORListForest<std::string> other(std::move(forest));
+        ExpectListEquals(other, 0, std::list<std::string>{"moved"});
+        EXPECT_EQ(forest.list_count(), 0u);
+    }
+}
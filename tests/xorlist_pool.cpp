@@ -0,0 +1,314 @@
+#include <XORList.hpp>
+#include <XORListPool.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace scc
+{
+    using PooledList = XORList<int, CanThrow::NoThrow, XORListPool<int>>;
+
+    TEST(XORListPoolTest, PushPopBothEnds)
+    {
+        PooledList list;
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.push_back(i);
+            list.push_front(-i);
+        }
+        EXPECT_EQ(list.size(), 10000);
+        EXPECT_EQ(list.front(), -4999);
+        EXPECT_EQ(list.back(), 4999);
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.pop_back();
+            list.pop_front();
+        }
+        EXPECT_TRUE(list.empty());
+    }
+
+    TEST(XORListPoolTest, RecyclesFreedNodes)
+    {
+        PooledList list;
+        list.push_back(1);
+        const int *first = &list.back();
+        list.pop_back();
+
+        list.push_back(2);
+        EXPECT_EQ(&list.back(), first);
+        EXPECT_EQ(list.back(), 2);
+    }
+
+    TEST(XORListPoolTest, NodesComeFromOneBlock)
+    {
+        PooledList list;
+        for (int i = 0; i < 64; ++i)
+        {
+            list.push_back(i);
+        }
+
+        const unsigned char *lowest = reinterpret_cast<const unsigned char *>(&list.front());
+        const unsigned char *highest = reinterpret_cast<const unsigned char *>(&list.back());
+        EXPECT_LT(static_cast<size_t>(highest - lowest), 64 * 4 * sizeof(void *));
+    }
+
+    TEST(XORListPoolTest, RangeConstructionUsesOneBatch)
+    {
+        std::vector<int> values(500);
+        for (int i = 0; i < 500; ++i)
+        {
+            values[i] = i;
+        }
+
+        PooledList list(values.begin(), values.end());
+        EXPECT_EQ(list.size(), 500);
+        EXPECT_TRUE(std::equal(list.cbegin(), list.cend(), values.begin(), values.end()));
+
+        // The nodes sit back to back in list order.
+        const unsigned char *previous = reinterpret_cast<const unsigned char *>(&list.front());
+        for (auto it = ++list.cbegin(); it != list.cend(); ++it)
+        {
+            const unsigned char *current = reinterpret_cast<const unsigned char *>(&*it);
+            EXPECT_EQ(current - previous, static_cast<std::ptrdiff_t>(2 * sizeof(void *)));
+            previous = current;
+        }
+
+        // Nodes of a batch are still freed one by one and recycled.
+        const int *second = &*++list.cbegin();
+        list.erase(++list.cbegin());
+        list.push_front(-1);
+        EXPECT_EQ(&list.front(), second);
+    }
+
+    TEST(XORListPoolTest, NodeHandlesMoveWithoutAllocating)
+    {
+        XORListPool<int> pool;
+        PooledList high(pool);
+        PooledList low(pool);
+        for (int i = 0; i < 10; ++i)
+        {
+            high.push_back(i);
+        }
+
+        std::vector<const int *> addresses;
+        while (!high.empty())
+        {
+            addresses.push_back(&high.back());
+            low.insert(low.cbegin(), high.extract(--high.cend()));
+        }
+
+        EXPECT_EQ(low.size(), 10);
+        int expected = 0;
+        for (const int &value : low)
+        {
+            EXPECT_EQ(value, expected);
+            EXPECT_EQ(&value, addresses[9 - expected]);
+            ++expected;
+        }
+    }
+
+    TEST(XORListPoolTest, CopiesShareStorage)
+    {
+        XORListPool<int> pool;
+        XORListPool<int> copy(pool);
+        XORListPool<double> rebound(pool);
+
+        EXPECT_TRUE(pool == copy);
+        EXPECT_TRUE(pool == rebound);
+        EXPECT_TRUE(pool != XORListPool<int>());
+
+        int *p = copy.allocate(1);
+        pool.deallocate(p, 1);
+        EXPECT_EQ(pool.allocate(1), p);
+    }
+
+    TEST(XORListPoolTest, ListsShareAPool)
+    {
+        XORListPool<int> pool;
+        PooledList list1(pool);
+        PooledList list2(pool);
+
+        list1.push_back(1);
+        list1.push_back(2);
+        list2.push_back(3);
+
+        const int *released = &list1.front();
+        list1.pop_front();
+        list2.push_back(4);
+        EXPECT_EQ(&list2.back(), released);
+        EXPECT_EQ(list1.front(), 2);
+        EXPECT_EQ(list2.front(), 3);
+    }
+
+    TEST(XORListPoolTest, CopyMoveAndSwap)
+    {
+        XORList<std::string, CanThrow::NoThrow, XORListPool<std::string>> list = {"a", "b", "c"};
+        auto copied = list;
+        auto moved = std::move(list);
+
+        EXPECT_EQ(copied, moved);
+        EXPECT_TRUE(list.empty());
+
+        copied.push_back("d");
+        copied.swap(moved);
+        EXPECT_EQ(moved.size(), 4);
+        EXPECT_EQ(copied.size(), 3);
+    }
+
+    TEST(XORListPoolTest, CopyIsOneBatch)
+    {
+        PooledList list;
+        for (int i = 0; i < 300; ++i)
+        {
+            list.push_front(i);
+        }
+
+        PooledList copy(list);
+        EXPECT_EQ(copy, list);
+        const unsigned char *first = reinterpret_cast<const unsigned char *>(&copy.front());
+        const unsigned char *last = reinterpret_cast<const unsigned char *>(&copy.back());
+        EXPECT_EQ(last - first, static_cast<std::ptrdiff_t>(299 * 2 * sizeof(void *)));
+    }
+
+    TEST(XORListPoolTest, ReadFromIsOneBatch)
+    {
+        PooledList list;
+        for (int i = 0; i < 300; ++i)
+        {
+            list.push_back(i);
+        }
+        std::vector<unsigned char> buffer;
+        ASSERT_TRUE(list.write_to(buffer));
+
+        PooledList loaded;
+        ASSERT_EQ(loaded.read_from(buffer.data(), buffer.size()), buffer.size());
+        EXPECT_EQ(loaded, list);
+        const unsigned char *first = reinterpret_cast<const unsigned char *>(&loaded.front());
+        const unsigned char *last = reinterpret_cast<const unsigned char *>(&loaded.back());
+        EXPECT_EQ(last - first, static_cast<std::ptrdiff_t>(299 * 2 * sizeof(void *)));
+    }
+
+    TEST(XORListPoolTest, ReadFromRejectsOversizedCount)
+    {
+        PooledList list;
+        for (int i = 0; i < 300; ++i)
+        {
+            list.push_back(i);
+        }
+        std::vector<unsigned char> buffer;
+        ASSERT_TRUE(list.write_to(buffer));
+
+        // The element count follows the 4-byte magic and the 4-byte element size.
+        const std::uint64_t claims[] = {std::uint64_t(1) << 40, std::uint64_t(1) << 62, std::numeric_limits<std::uint64_t>::max()};
+        for (std::uint64_t claim : claims)
+        {
+            std::vector<unsigned char> forged = buffer;
+            std::memcpy(forged.data() + 8, &claim, sizeof(claim));
+
+            PooledList target{7, 8};
+            EXPECT_EQ(target.read_from(forged.data(), forged.size()), 0u);
+            EXPECT_EQ(target, PooledList({7, 8}));
+
+            XORList<int, CanThrow::Throw, XORListPool<int>> throwing{7};
+            EXPECT_THROW(throwing.read_from(forged.data(), forged.size()), std::ios_base::failure);
+            EXPECT_EQ(throwing.size(), 1);
+        }
+    }
+
+    TEST(XORListPoolTest, OverflowingAllocationThrows)
+    {
+        XORListPool<std::uint64_t> pool;
+        EXPECT_THROW(pool.allocate(std::numeric_limits<size_t>::max() / 4), std::bad_alloc);
+        EXPECT_THROW(pool.allocate(std::numeric_limits<size_t>::max() / sizeof(std::uint64_t)), std::bad_alloc);
+    }
+
+    TEST(XORListPoolTest, ClearReleasesSolePoolInBulk)
+    {
+        PooledList list;
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.push_back(i);
+        }
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(list.begin(), list.end());
+
+        // The pool hands its slots out again from the start of the kept block.
+        for (int i = 0; i < 5000; ++i)
+        {
+            list.push_front(i);
+        }
+        EXPECT_EQ(list.size(), 5000);
+        EXPECT_EQ(list.front(), 4999);
+        EXPECT_EQ(list.back(), 0);
+    }
+
+    TEST(XORListPoolTest, ClearKeepsSharedPoolSlots)
+    {
+        PooledList list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back(i);
+        }
+        PooledList sharing(list); // copies share the pool, so clearing one must not reclaim the other's nodes
+        list.clear();
+        list.assign(100, -1);
+        EXPECT_EQ(sharing.size(), 100);
+        EXPECT_EQ(sharing.back(), 99);
+
+        // An outstanding node handle also keeps the pool shared.
+        auto handle = sharing.extract(sharing.cbegin());
+        sharing.clear();
+        sharing.assign(200, -2);
+        EXPECT_EQ(handle.value(), 0);
+    }
+
+    TEST(XORListPoolTest, CompactLaysNodesOutInOrder)
+    {
+        PooledList list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                list.push_back(i);
+            }
+            else
+            {
+                list.push_front(i);
+            }
+        }
+
+        list.compact();
+        const unsigned char *previous = nullptr;
+        for (const int &value : list)
+        {
+            const unsigned char *address = reinterpret_cast<const unsigned char *>(&value);
+            if (previous != nullptr)
+            {
+                EXPECT_EQ(address - previous, static_cast<std::ptrdiff_t>(2 * sizeof(void *)));
+            }
+            previous = address;
+        }
+        EXPECT_EQ(list.front(), 999);
+        EXPECT_EQ(list.back(), 998);
+    }
+
+    TEST(XORListPoolTest, WorksWithStdList)
+    {
+        std::list<int, XORListPool<int>> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+        list.remove_if([](int value)
+                       { return value % 2 == 0; });
+        EXPECT_EQ(list.size(), 500);
+        EXPECT_EQ(list.front(), 1);
+    }
+} // namespace scc